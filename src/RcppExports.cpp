@@ -5,12 +5,51 @@
 
 using namespace Rcpp;
 
+// is_altrep
+bool is_altrep(SEXP x);
+RcppExport SEXP _almanac_is_altrep(SEXP xSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
+    rcpp_result_gen = Rcpp::wrap(is_altrep(x));
+    return rcpp_result_gen;
+END_RCPP
+}
+// calendar_names
+std::vector<std::string> calendar_names();
+RcppExport SEXP _almanac_calendar_names() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    rcpp_result_gen = Rcpp::wrap(calendar_names());
+    return rcpp_result_gen;
+END_RCPP
+}
+// calendar_compile
+SEXP calendar_compile(const Rcpp::List& calendar);
+RcppExport SEXP _almanac_calendar_compile(SEXP calendarSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
+    rcpp_result_gen = Rcpp::wrap(calendar_compile(calendar));
+    return rcpp_result_gen;
+END_RCPP
+}
+// calendar_has_handle
+bool calendar_has_handle(const Rcpp::List& calendar);
+RcppExport SEXP _almanac_calendar_has_handle(SEXP calendarSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
+    rcpp_result_gen = Rcpp::wrap(calendar_has_handle(calendar));
+    return rcpp_result_gen;
+END_RCPP
+}
 // calendar_adjust
-Rcpp::DateVector calendar_adjust(const Rcpp::DateVector x, const std::string& convention, const Rcpp::List& calendar);
+Rcpp::DateVector calendar_adjust(SEXP x, const std::string& convention, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_adjust(SEXP xSEXP, SEXP conventionSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const std::string& >::type convention(conventionSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_adjust(x, convention, calendar));
@@ -18,76 +57,89 @@ BEGIN_RCPP
 END_RCPP
 }
 // calendar_count
-Rcpp::IntegerVector calendar_count(const Rcpp::DateVector& starts, const Rcpp::DateVector& stops, const Rcpp::List& calendar);
+Rcpp::IntegerVector calendar_count(SEXP starts, SEXP stops, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_count(SEXP startsSEXP, SEXP stopsSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector& >::type starts(startsSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::DateVector& >::type stops(stopsSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type starts(startsSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type stops(stopsSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_count(starts, stops, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
 // calendar_is_weekend
-Rcpp::LogicalVector calendar_is_weekend(const Rcpp::DateVector x, const Rcpp::List& calendar);
+Rcpp::LogicalVector calendar_is_weekend(SEXP x, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_is_weekend(SEXP xSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_is_weekend(x, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
 // calendar_is_business_day
-Rcpp::LogicalVector calendar_is_business_day(const Rcpp::DateVector x, const Rcpp::List& calendar);
+Rcpp::LogicalVector calendar_is_business_day(SEXP x, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_is_business_day(SEXP xSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_is_business_day(x, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
 // calendar_is_holiday
-Rcpp::LogicalVector calendar_is_holiday(const Rcpp::DateVector x, const Rcpp::List& calendar);
+Rcpp::LogicalVector calendar_is_holiday(SEXP x, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_is_holiday(SEXP xSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_is_holiday(x, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
 // calendar_is_end_of_month
-Rcpp::LogicalVector calendar_is_end_of_month(const Rcpp::DateVector x, const Rcpp::List& calendar);
+Rcpp::LogicalVector calendar_is_end_of_month(SEXP x, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_is_end_of_month(SEXP xSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_is_end_of_month(x, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
 // calendar_holidays_between
-Rcpp::DateVector calendar_holidays_between(const Rcpp::DateVector& start, const Rcpp::DateVector& stop, const bool& weekends, const Rcpp::List& calendar);
+Rcpp::List calendar_holidays_between(SEXP start, SEXP stop, const bool& weekends, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_holidays_between(SEXP startSEXP, SEXP stopSEXP, SEXP weekendsSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector& >::type start(startSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::DateVector& >::type stop(stopSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type start(startSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type stop(stopSEXP);
     Rcpp::traits::input_parameter< const bool& >::type weekends(weekendsSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_holidays_between(start, stop, weekends, calendar));
     return rcpp_result_gen;
 END_RCPP
 }
+// calendar_holidays_all_calendars
+Rcpp::List calendar_holidays_all_calendars(const std::vector<std::string>& names, SEXP start, SEXP stop, const bool& weekends);
+RcppExport SEXP _almanac_calendar_holidays_all_calendars(SEXP namesSEXP, SEXP startSEXP, SEXP stopSEXP, SEXP weekendsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const std::vector<std::string>& >::type names(namesSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type start(startSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type stop(stopSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type weekends(weekendsSEXP);
+    rcpp_result_gen = Rcpp::wrap(calendar_holidays_all_calendars(names, start, stop, weekends));
+    return rcpp_result_gen;
+END_RCPP
+}
 // calendar_seq
-Rcpp::DateVector calendar_seq(const Rcpp::DateVector& start, const Rcpp::DateVector& stop, const int& by, const std::string& unit, const std::string& start_convention, const std::string& stop_convention, const bool& end_of_month, const Rcpp::List& calendar);
+SEXP calendar_seq(const Rcpp::DateVector& start, const Rcpp::DateVector& stop, const int& by, const std::string& unit, const std::string& start_convention, const std::string& stop_convention, const bool& end_of_month, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_seq(SEXP startSEXP, SEXP stopSEXP, SEXP bySEXP, SEXP unitSEXP, SEXP start_conventionSEXP, SEXP stop_conventionSEXP, SEXP end_of_monthSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -103,12 +155,29 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// calendar_seq_many
+Rcpp::List calendar_seq_many(SEXP start, SEXP stop, const std::vector<int>& by, const std::vector<std::string>& unit, const std::vector<std::string>& start_convention, const std::vector<std::string>& stop_convention, const std::vector<bool>& end_of_month, const Rcpp::List& calendar);
+RcppExport SEXP _almanac_calendar_seq_many(SEXP startSEXP, SEXP stopSEXP, SEXP bySEXP, SEXP unitSEXP, SEXP start_conventionSEXP, SEXP stop_conventionSEXP, SEXP end_of_monthSEXP, SEXP calendarSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type start(startSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type stop(stopSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type by(bySEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string>& >::type unit(unitSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string>& >::type start_convention(start_conventionSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string>& >::type stop_convention(stop_conventionSEXP);
+    Rcpp::traits::input_parameter< const std::vector<bool>& >::type end_of_month(end_of_monthSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
+    rcpp_result_gen = Rcpp::wrap(calendar_seq_many(start, stop, by, unit, start_convention, stop_convention, end_of_month, calendar));
+    return rcpp_result_gen;
+END_RCPP
+}
 // calendar_shift
-Rcpp::DateVector calendar_shift(const Rcpp::DateVector& x, const Rcpp::List& period, const std::string& convention, const Rcpp::List& calendar);
+Rcpp::DateVector calendar_shift(SEXP x, const Rcpp::List& period, const std::string& convention, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_shift(SEXP xSEXP, SEXP periodSEXP, SEXP conventionSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type period(periodSEXP);
     Rcpp::traits::input_parameter< const std::string& >::type convention(conventionSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
@@ -117,11 +186,11 @@ BEGIN_RCPP
 END_RCPP
 }
 // calendar_shift_end_of_month
-Rcpp::DateVector calendar_shift_end_of_month(const Rcpp::DateVector x, const Rcpp::List& calendar);
+Rcpp::DateVector calendar_shift_end_of_month(SEXP x, const Rcpp::List& calendar);
 RcppExport SEXP _almanac_calendar_shift_end_of_month(SEXP xSEXP, SEXP calendarSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const Rcpp::DateVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const Rcpp::List& >::type calendar(calendarSEXP);
     rcpp_result_gen = Rcpp::wrap(calendar_shift_end_of_month(x, calendar));
     return rcpp_result_gen;
@@ -129,6 +198,10 @@ END_RCPP
 }
 
 static const R_CallMethodDef CallEntries[] = {
+    {"_almanac_is_altrep", (DL_FUNC) &_almanac_is_altrep, 1},
+    {"_almanac_calendar_names", (DL_FUNC) &_almanac_calendar_names, 0},
+    {"_almanac_calendar_compile", (DL_FUNC) &_almanac_calendar_compile, 1},
+    {"_almanac_calendar_has_handle", (DL_FUNC) &_almanac_calendar_has_handle, 1},
     {"_almanac_calendar_adjust", (DL_FUNC) &_almanac_calendar_adjust, 3},
     {"_almanac_calendar_count", (DL_FUNC) &_almanac_calendar_count, 3},
     {"_almanac_calendar_is_weekend", (DL_FUNC) &_almanac_calendar_is_weekend, 2},
@@ -136,13 +209,17 @@ static const R_CallMethodDef CallEntries[] = {
     {"_almanac_calendar_is_holiday", (DL_FUNC) &_almanac_calendar_is_holiday, 2},
     {"_almanac_calendar_is_end_of_month", (DL_FUNC) &_almanac_calendar_is_end_of_month, 2},
     {"_almanac_calendar_holidays_between", (DL_FUNC) &_almanac_calendar_holidays_between, 4},
+    {"_almanac_calendar_holidays_all_calendars", (DL_FUNC) &_almanac_calendar_holidays_all_calendars, 4},
     {"_almanac_calendar_seq", (DL_FUNC) &_almanac_calendar_seq, 8},
+    {"_almanac_calendar_seq_many", (DL_FUNC) &_almanac_calendar_seq_many, 8},
     {"_almanac_calendar_shift", (DL_FUNC) &_almanac_calendar_shift, 4},
     {"_almanac_calendar_shift_end_of_month", (DL_FUNC) &_almanac_calendar_shift_end_of_month, 2},
     {NULL, NULL, 0}
 };
 
+void almanac_init_altrep(DllInfo* dll);
 RcppExport void R_init_almanac(DllInfo *dll) {
     R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
     R_useDynamicSymbols(dll, FALSE);
+    almanac_init_altrep(dll);
 }
@@ -2,18 +2,106 @@
 #define ALMANAC_H
 
 #include <Rcpp.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "ql/time/date.hpp"
 #include "ql/time/calendar.hpp"
 
 // -----------------------------------------------------------------------------
 // Coercion
 
+// Days between the QuantLib (1899-12-30) and R (1970-01-01) epochs
+static const int quantlib_to_r_offset_in_days = 25569;
+
 QuantLib::Date as_quantlib_date(const Rcpp::Date& date);
 Rcpp::Date as_r_date(const QuantLib::Date& date);
 
+// -----------------------------------------------------------------------------
+// Serial coercion
+//
+// These work directly on the number of days since the epoch that R stores,
+// without going through `Rcpp::Date`. They are cheap enough to call once per
+// element in the kernels, and safe to call off the main thread.
+//
+// Missing and non-finite dates become a null `QuantLib::Date`, which comes
+// back out as `NA`. Fractional days are floored, as R does. Dates outside of
+// the range QuantLib supports are rejected by `QuantLib::Date`, as usual.
+
+inline QuantLib::Date as_quantlib_date(double date) {
+  if (!std::isfinite(date)) {
+    return QuantLib::Date();
+  }
+
+  // Keep far out of range dates from overflowing, `QuantLib::Date` still
+  // rejects them
+  double serial = std::floor(date) + quantlib_to_r_offset_in_days;
+  serial = std::max(serial, static_cast<double>(std::numeric_limits<int>::min()));
+  serial = std::min(serial, static_cast<double>(std::numeric_limits<int>::max()));
+
+  return QuantLib::Date(static_cast<QuantLib::Date::serial_type>(serial));
+}
+
+inline QuantLib::Date as_quantlib_date(int date) {
+  if (date == NA_INTEGER) {
+    return QuantLib::Date();
+  }
+
+  QuantLib::Date::serial_type serial = date;
+
+  return QuantLib::Date(serial + quantlib_to_r_offset_in_days);
+}
+
+inline double as_r_double(const QuantLib::Date& date) {
+  if (date == QuantLib::Date()) {
+    return NA_REAL;
+  }
+
+  return static_cast<double>(date.serialNumber() - quantlib_to_r_offset_in_days);
+}
+
+// Read only access to the storage of a Date vector, which R allows to be
+// either doubles or integers. Construct it on the main thread, after which
+// the dates can be read from any thread.
+class r_dates {
+public:
+  explicit r_dates(SEXP x);
+
+  R_xlen_t size() const {
+    return size_;
+  }
+
+  QuantLib::Date operator[](R_xlen_t i) const {
+    if (p_double_ != NULL) {
+      return as_quantlib_date(p_double_[i]);
+    } else {
+      return as_quantlib_date(p_int_[i]);
+    }
+  }
+
+  // Whether element `i` holds the same value as element `i - 1`. Sorted
+  // inputs, such as time series indices, come in runs of equal dates, so
+  // kernels use this to reuse the previous result for the rest of a run.
+  bool repeats(R_xlen_t i) const {
+    if (p_double_ != NULL) {
+      return p_double_[i] == p_double_[i - 1];
+    } else {
+      return p_int_[i] == p_int_[i - 1];
+    }
+  }
+
+private:
+  const double* p_double_;
+  const int* p_int_;
+  R_xlen_t size_;
+};
+
 // -----------------------------------------------------------------------------
 
 QuantLib::Calendar new_calendar(const Rcpp::List& calendar);
-void reset_calendar(QuantLib::Calendar calendar);
+
+// The market calendar of the given name, without any added or removed
+// holidays. Unknown names are an error, so call it on the main thread.
+QuantLib::Calendar init_calendar(const std::string& name);
 
 #endif
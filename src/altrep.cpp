@@ -0,0 +1,165 @@
+#include "altrep.h"
+
+#ifdef ALMANAC_HAS_ALTREP
+
+#include <R_ext/Altrep.h>
+
+struct business_day_seq {
+  QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex> index;
+  QuantLib::Size first;
+  R_xlen_t size;
+  bool reverse;
+};
+
+static R_altrep_class_t business_day_seq_class;
+
+// data1 holds the sequence, data2 the materialized vector once there is one
+
+static const business_day_seq* business_day_seq_get(SEXP x) {
+  return static_cast<business_day_seq*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+static double business_day_seq_value(const business_day_seq* seq, R_xlen_t i) {
+  R_xlen_t offset = seq->reverse ? seq->size - 1 - i : i;
+  return as_r_double(seq->index->select(seq->first + offset));
+}
+
+static R_xlen_t business_day_seq_length(SEXP x) {
+  return business_day_seq_get(x)->size;
+}
+
+static Rboolean business_day_seq_inspect(SEXP x,
+                                         int pre,
+                                         int deep,
+                                         int pvec,
+                                         void (*inspect_subtree)(SEXP, int, int, int)) {
+  const business_day_seq* seq = business_day_seq_get(x);
+  bool materialized = R_altrep_data2(x) != R_NilValue;
+
+  Rprintf(
+    "almanac business day sequence (size = %lld, materialized = %s)\n",
+    static_cast<long long>(seq->size),
+    materialized ? "TRUE" : "FALSE"
+  );
+
+  return TRUE;
+}
+
+static void* business_day_seq_dataptr(SEXP x, Rboolean writeable) {
+  SEXP data = R_altrep_data2(x);
+
+  if (data == R_NilValue) {
+    const business_day_seq* seq = business_day_seq_get(x);
+
+    data = PROTECT(Rf_allocVector(REALSXP, seq->size));
+    double* p_data = REAL(data);
+
+    for (R_xlen_t i = 0; i < seq->size; ++i) {
+      p_data[i] = business_day_seq_value(seq, i);
+    }
+
+    R_set_altrep_data2(x, data);
+    UNPROTECT(1);
+  }
+
+  return REAL(data);
+}
+
+static const void* business_day_seq_dataptr_or_null(SEXP x) {
+  SEXP data = R_altrep_data2(x);
+
+  if (data == R_NilValue) {
+    return NULL;
+  }
+
+  return REAL(data);
+}
+
+static double business_day_seq_elt(SEXP x, R_xlen_t i) {
+  SEXP data = R_altrep_data2(x);
+
+  if (data != R_NilValue) {
+    return REAL(data)[i];
+  }
+
+  return business_day_seq_value(business_day_seq_get(x), i);
+}
+
+static R_xlen_t business_day_seq_get_region(SEXP x,
+                                            R_xlen_t i,
+                                            R_xlen_t n,
+                                            double* buf) {
+  const business_day_seq* seq = business_day_seq_get(x);
+  n = std::min(n, seq->size - i);
+
+  SEXP data = R_altrep_data2(x);
+
+  if (data != R_NilValue) {
+    std::copy(REAL(data) + i, REAL(data) + i + n, buf);
+    return n;
+  }
+
+  for (R_xlen_t j = 0; j < n; ++j) {
+    buf[j] = business_day_seq_value(seq, i + j);
+  }
+
+  return n;
+}
+
+// The materialized vector can be written to, so only the lazy sequence
+// knows that it is sorted and free of `NA`s
+static int business_day_seq_is_sorted(SEXP x) {
+  if (R_altrep_data2(x) != R_NilValue) {
+    return UNKNOWN_SORTEDNESS;
+  }
+
+  return business_day_seq_get(x)->reverse ? SORTED_DECR : SORTED_INCR;
+}
+
+static int business_day_seq_no_na(SEXP x) {
+  return R_altrep_data2(x) == R_NilValue;
+}
+
+SEXP new_business_day_seq(const QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex>& index,
+                          QuantLib::Size first,
+                          R_xlen_t size,
+                          bool reverse) {
+  business_day_seq seq = {index, first, size, reverse};
+  Rcpp::XPtr<business_day_seq> data1(new business_day_seq(seq), true);
+
+  SEXP out = PROTECT(R_new_altrep(business_day_seq_class, data1, R_NilValue));
+  Rf_setAttrib(out, R_ClassSymbol, Rf_mkString("Date"));
+
+  UNPROTECT(1);
+  return out;
+}
+
+#endif
+
+// Exposed for the tests, to tell lazy sequences from ordinary vectors
+// [[Rcpp::export(rng=false)]]
+bool is_altrep(SEXP x) {
+#ifdef ALMANAC_HAS_ALTREP
+  return ALTREP(x);
+#else
+  return false;
+#endif
+}
+
+// [[Rcpp::init]]
+void almanac_init_altrep(DllInfo* dll) {
+#ifdef ALMANAC_HAS_ALTREP
+  business_day_seq_class = R_make_altreal_class("business_day_seq", "almanac", dll);
+
+  R_set_altrep_Length_method(business_day_seq_class, business_day_seq_length);
+  R_set_altrep_Inspect_method(business_day_seq_class, business_day_seq_inspect);
+
+  R_set_altvec_Dataptr_method(business_day_seq_class, business_day_seq_dataptr);
+  R_set_altvec_Dataptr_or_null_method(business_day_seq_class, business_day_seq_dataptr_or_null);
+
+  R_set_altreal_Elt_method(business_day_seq_class, business_day_seq_elt);
+  R_set_altreal_Get_region_method(business_day_seq_class, business_day_seq_get_region);
+  R_set_altreal_Is_sorted_method(business_day_seq_class, business_day_seq_is_sorted);
+  R_set_altreal_No_NA_method(business_day_seq_class, business_day_seq_no_na);
+#endif
+}
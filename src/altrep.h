@@ -0,0 +1,33 @@
+#ifndef ALMANAC_ALTREP_H
+#define ALMANAC_ALTREP_H
+
+#include "almanac.h"
+#include "ql/time/businessdayindex.hpp"
+#include <Rversion.h>
+
+// -----------------------------------------------------------------------------
+// Lazy business day sequences
+//
+// On R >= 3.6.0, daily sequences are returned as ALTREP Date vectors that
+// only hold a compiled business day index and a range of ranks in it. The
+// length is known up front, elements are selected from the index when
+// R asks for them, and the full vector is only allocated when R needs a
+// pointer to its data. On older versions of R, sequences are materialized.
+
+#if R_VERSION >= R_Version(3, 6, 0)
+#define ALMANAC_HAS_ALTREP
+#endif
+
+#ifdef ALMANAC_HAS_ALTREP
+
+// The business days of `index` with ranks in `[first, first + size)`, in
+// decreasing order when `reverse` is set. The sequence holds on to `index`,
+// so it stays valid whatever happens to the calendar it came from.
+SEXP new_business_day_seq(const QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex>& index,
+                          QuantLib::Size first,
+                          R_xlen_t size,
+                          bool reverse);
+
+#endif
+
+#endif
@@ -1,124 +1,334 @@
 #include "almanac.h"
 #include "utils.h"
 #include "ql/time/calendars/all.hpp"
+#include <cstring>
 
 // Defined below
 static QuantLib::BespokeCalendar new_empty_calendar(const Rcpp::List& calendar);
+static QuantLib::Calendar new_joint_calendar(const Rcpp::List& calendar);
 
 // -----------------------------------------------------------------------------
+// Market registry
+//
+// Every market calendar is listed here under its R name, along with a
+// factory building it. Countries are listed under their own name, which
+// gives QuantLib's default market, and under one name per market variant.
+// The table is sorted by name so that lookups are a binary search. The
+// `calendars` object on the R side is generated from it into R/calendars.R by
+// `write_calendars()` in extra/sync.R; `calendar_names()` lets the tests check
+// that the two agree.
+
+typedef QuantLib::Calendar (*calendar_factory)();
+
+template <class C>
+static QuantLib::Calendar make_calendar() {
+  return C();
+}
 
-void reset_added_holidays(QuantLib::Calendar calendar) {
-  std::set<QuantLib::Date> holidays = calendar.addedHolidays();
-  std::set<QuantLib::Date>::iterator it;
+template <class C, typename C::Market market>
+static QuantLib::Calendar make_market_calendar() {
+  return C(market);
+}
 
-  for (it = holidays.begin(); it != holidays.end(); ++it){
-    calendar.removeHoliday(*it);
-  }
+struct market {
+  const char* name;
+  calendar_factory factory;
+};
+
+static const market markets[] = {
+  {"argentina",                         make_calendar<QuantLib::Argentina>},
+  {"argentina_merval",                  make_market_calendar<QuantLib::Argentina, QuantLib::Argentina::Merval>},
+  {"australia",                         make_calendar<QuantLib::Australia>},
+  {"botswana",                          make_calendar<QuantLib::Botswana>},
+  {"brazil",                            make_calendar<QuantLib::Brazil>},
+  {"brazil_exchange",                   make_market_calendar<QuantLib::Brazil, QuantLib::Brazil::Exchange>},
+  {"brazil_settlement",                 make_market_calendar<QuantLib::Brazil, QuantLib::Brazil::Settlement>},
+  {"canada",                            make_calendar<QuantLib::Canada>},
+  {"canada_settlement",                 make_market_calendar<QuantLib::Canada, QuantLib::Canada::Settlement>},
+  {"canada_tsx",                        make_market_calendar<QuantLib::Canada, QuantLib::Canada::TSX>},
+  {"china",                             make_calendar<QuantLib::China>},
+  {"china_ib",                          make_market_calendar<QuantLib::China, QuantLib::China::IB>},
+  {"china_sse",                         make_market_calendar<QuantLib::China, QuantLib::China::SSE>},
+  {"czech_republic",                    make_calendar<QuantLib::CzechRepublic>},
+  {"czech_republic_pse",                make_market_calendar<QuantLib::CzechRepublic, QuantLib::CzechRepublic::PSE>},
+  {"denmark",                           make_calendar<QuantLib::Denmark>},
+  {"finland",                           make_calendar<QuantLib::Finland>},
+  {"france",                            make_calendar<QuantLib::France>},
+  {"france_exchange",                   make_market_calendar<QuantLib::France, QuantLib::France::Exchange>},
+  {"france_settlement",                 make_market_calendar<QuantLib::France, QuantLib::France::Settlement>},
+  {"germany",                           make_calendar<QuantLib::Germany>},
+  {"germany_eurex",                     make_market_calendar<QuantLib::Germany, QuantLib::Germany::Eurex>},
+  {"germany_euwax",                     make_market_calendar<QuantLib::Germany, QuantLib::Germany::Euwax>},
+  {"germany_frankfurt_stock_exchange",  make_market_calendar<QuantLib::Germany, QuantLib::Germany::FrankfurtStockExchange>},
+  {"germany_settlement",                make_market_calendar<QuantLib::Germany, QuantLib::Germany::Settlement>},
+  {"germany_xetra",                     make_market_calendar<QuantLib::Germany, QuantLib::Germany::Xetra>},
+  {"hong_kong",                         make_calendar<QuantLib::HongKong>},
+  {"hong_kong_hkex",                    make_market_calendar<QuantLib::HongKong, QuantLib::HongKong::HKEx>},
+  {"hungary",                           make_calendar<QuantLib::Hungary>},
+  {"iceland",                           make_calendar<QuantLib::Iceland>},
+  {"iceland_icex",                      make_market_calendar<QuantLib::Iceland, QuantLib::Iceland::ICEX>},
+  {"india",                             make_calendar<QuantLib::India>},
+  {"india_nse",                         make_market_calendar<QuantLib::India, QuantLib::India::NSE>},
+  {"indonesia",                         make_calendar<QuantLib::Indonesia>},
+  {"indonesia_bej",                     make_market_calendar<QuantLib::Indonesia, QuantLib::Indonesia::BEJ>},
+  {"indonesia_idx",                     make_market_calendar<QuantLib::Indonesia, QuantLib::Indonesia::IDX>},
+  {"indonesia_jsx",                     make_market_calendar<QuantLib::Indonesia, QuantLib::Indonesia::JSX>},
+  {"israel",                            make_calendar<QuantLib::Israel>},
+  {"israel_settlement",                 make_market_calendar<QuantLib::Israel, QuantLib::Israel::Settlement>},
+  {"israel_tase",                       make_market_calendar<QuantLib::Israel, QuantLib::Israel::TASE>},
+  {"italy",                             make_calendar<QuantLib::Italy>},
+  {"italy_exchange",                    make_market_calendar<QuantLib::Italy, QuantLib::Italy::Exchange>},
+  {"italy_settlement",                  make_market_calendar<QuantLib::Italy, QuantLib::Italy::Settlement>},
+  {"japan",                             make_calendar<QuantLib::Japan>},
+  {"mexico",                            make_calendar<QuantLib::Mexico>},
+  {"mexico_bmv",                        make_market_calendar<QuantLib::Mexico, QuantLib::Mexico::BMV>},
+  {"new_zealand",                       make_calendar<QuantLib::NewZealand>},
+  {"norway",                            make_calendar<QuantLib::Norway>},
+  {"poland",                            make_calendar<QuantLib::Poland>},
+  {"romania",                           make_calendar<QuantLib::Romania>},
+  {"russia",                            make_calendar<QuantLib::Russia>},
+  {"russia_moex",                       make_market_calendar<QuantLib::Russia, QuantLib::Russia::MOEX>},
+  {"russia_settlement",                 make_market_calendar<QuantLib::Russia, QuantLib::Russia::Settlement>},
+  {"saudi_arabia",                      make_calendar<QuantLib::SaudiArabia>},
+  {"saudi_arabia_tadawul",              make_market_calendar<QuantLib::SaudiArabia, QuantLib::SaudiArabia::Tadawul>},
+  {"singapore",                         make_calendar<QuantLib::Singapore>},
+  {"singapore_sgx",                     make_market_calendar<QuantLib::Singapore, QuantLib::Singapore::SGX>},
+  {"slovakia",                          make_calendar<QuantLib::Slovakia>},
+  {"slovakia_bsse",                     make_market_calendar<QuantLib::Slovakia, QuantLib::Slovakia::BSSE>},
+  {"south_africa",                      make_calendar<QuantLib::SouthAfrica>},
+  {"south_korea",                       make_calendar<QuantLib::SouthKorea>},
+  {"south_korea_krx",                   make_market_calendar<QuantLib::SouthKorea, QuantLib::SouthKorea::KRX>},
+  {"south_korea_settlement",            make_market_calendar<QuantLib::SouthKorea, QuantLib::SouthKorea::Settlement>},
+  {"sweden",                            make_calendar<QuantLib::Sweden>},
+  {"switzerland",                       make_calendar<QuantLib::Switzerland>},
+  {"taiwan",                            make_calendar<QuantLib::Taiwan>},
+  {"taiwan_tsec",                       make_market_calendar<QuantLib::Taiwan, QuantLib::Taiwan::TSEC>},
+  {"target",                            make_calendar<QuantLib::TARGET>},
+  {"thailand",                          make_calendar<QuantLib::Thailand>},
+  {"turkey",                            make_calendar<QuantLib::Turkey>},
+  {"ukraine",                           make_calendar<QuantLib::Ukraine>},
+  {"ukraine_use",                       make_market_calendar<QuantLib::Ukraine, QuantLib::Ukraine::USE>},
+  {"united_kingdom",                    make_calendar<QuantLib::UnitedKingdom>},
+  {"united_kingdom_exchange",           make_market_calendar<QuantLib::UnitedKingdom, QuantLib::UnitedKingdom::Exchange>},
+  {"united_kingdom_metals",             make_market_calendar<QuantLib::UnitedKingdom, QuantLib::UnitedKingdom::Metals>},
+  {"united_kingdom_settlement",         make_market_calendar<QuantLib::UnitedKingdom, QuantLib::UnitedKingdom::Settlement>},
+  {"united_states",                     make_calendar<QuantLib::UnitedStates>},
+  {"united_states_federal_reserve",     make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::FederalReserve>},
+  {"united_states_government_bond",     make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::GovernmentBond>},
+  {"united_states_libor_impact",        make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::LiborImpact>},
+  {"united_states_nerc",                make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::NERC>},
+  {"united_states_nyse",                make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::NYSE>},
+  {"united_states_settlement",          make_market_calendar<QuantLib::UnitedStates, QuantLib::UnitedStates::Settlement>},
+  {"weekends_only",                     make_calendar<QuantLib::WeekendsOnly>}
+};
+
+static const market* markets_end = markets + sizeof(markets) / sizeof(markets[0]);
+
+static bool market_name_less(const market& x, const char* name) {
+  return std::strcmp(x.name, name) < 0;
 }
 
-void reset_removed_holidays(QuantLib::Calendar calendar) {
-  std::set<QuantLib::Date> holidays = calendar.removedHolidays();
-  std::set<QuantLib::Date>::iterator it;
+QuantLib::Calendar init_calendar(const std::string& name) {
+  const market* it = std::lower_bound(
+    markets,
+    markets_end,
+    name.c_str(),
+    market_name_less
+  );
 
-  for (it = holidays.begin(); it != holidays.end(); ++it){
-    calendar.addHoliday(*it);
+  if (it != markets_end && name == it->name) {
+    return it->factory();
   }
-}
 
-void reset_calendar(QuantLib::Calendar calendar) {
-  reset_added_holidays(calendar);
-  reset_removed_holidays(calendar);
+  Rf_errorcall(R_NilValue, "Unknown calendar name, '%s'", name.c_str());
 }
 
-// -----------------------------------------------------------------------------
+// [[Rcpp::export(rng=false)]]
+std::vector<std::string> calendar_names() {
+  std::vector<std::string> out;
 
-static QuantLib::Calendar init_calendar(const std::string& name) {
-  if (name == "argentina" || name == "argentina_merval") {
-    return QuantLib::Argentina(QuantLib::Argentina::Merval);
+  for (const market* it = markets; it != markets_end; ++it) {
+    out.push_back(it->name);
   }
 
-  if (name == "united_states" || name == "united_states_settlement") {
-    return QuantLib::UnitedStates(QuantLib::UnitedStates::Settlement);
-  }
-
-  Rf_errorcall(R_NilValue, "Unknown calendar name, '%s'", name.c_str());
+  return out;
 }
 
 // -----------------------------------------------------------------------------
 
-static void add_holidays(QuantLib::Calendar calendar, const Rcpp::DateVector& dates) {
-  int size = dates.size();
-
-  if (size == 0) {
-    return;
-  }
-
-  Rcpp::Date date;
-  QuantLib::Date holiday;
+static void add_holidays(QuantLib::Calendar& calendar, SEXP holidays) {
+  r_dates dates(holidays);
+  R_xlen_t size = dates.size();
 
-  for(int i = 0; i < size; i++) {
-    date = dates[i];
+  for (R_xlen_t i = 0; i < size; ++i) {
+    QuantLib::Date holiday = dates[i];
 
-    if (Rcpp::DateVector::is_na(date)) {
+    if (holiday == QuantLib::Date()) {
       continue;
     }
 
-    holiday = as_quantlib_date(date);
     calendar.addHoliday(holiday);
   }
 }
 
-static void remove_holidays(QuantLib::Calendar calendar, const Rcpp::DateVector& dates) {
-  int size = dates.size();
+static void remove_holidays(QuantLib::Calendar& calendar, SEXP holidays) {
+  r_dates dates(holidays);
+  R_xlen_t size = dates.size();
 
-  if (size == 0) {
-    return;
-  }
-
-  Rcpp::Date date;
-  QuantLib::Date holiday;
+  for (R_xlen_t i = 0; i < size; ++i) {
+    QuantLib::Date holiday = dates[i];
 
-  for(int i = 0; i < size; i++) {
-    date = dates[i];
-
-    if (Rcpp::DateVector::is_na(date)) {
+    if (holiday == QuantLib::Date()) {
       continue;
     }
 
-    holiday = as_quantlib_date(date);
     calendar.removeHoliday(holiday);
   }
 }
 
-void adjust_holidays(QuantLib::Calendar calendar,
-                     const Rcpp::DateVector& added_holidays,
-                     const Rcpp::DateVector& removed_holidays) {
+void adjust_holidays(QuantLib::Calendar& calendar,
+                     SEXP added_holidays,
+                     SEXP removed_holidays) {
   add_holidays(calendar, added_holidays);
   remove_holidays(calendar, removed_holidays);
 }
 
 // -----------------------------------------------------------------------------
 
-QuantLib::Calendar new_calendar(const Rcpp::List& calendar) {
+static QuantLib::Calendar build_calendar(const Rcpp::List& calendar) {
   std::string name = calendar[0];
 
   if (name == "empty") {
     return new_empty_calendar(calendar);
   }
 
+  if (name == "joint") {
+    return new_joint_calendar(calendar);
+  }
+
   QuantLib::Calendar ql_calendar = init_calendar(name);
 
-  Rcpp::DateVector added_holidays = calendar[1];
-  Rcpp::DateVector removed_holidays = calendar[2];
+  SEXP added_holidays = calendar[1];
+  SEXP removed_holidays = calendar[2];
 
   adjust_holidays(ql_calendar, added_holidays, removed_holidays);
 
+  // Kernels only ever query the calendar, so evaluate the rules once
+  // up front and answer every query from the business day index
+  ql_calendar.compile();
+
   return ql_calendar;
 }
 
+// -----------------------------------------------------------------------------
+// Native handles
+//
+// `calendar_compile()` builds the compiled calendar once and returns it as an
+// external pointer, which the R side caches on the calendar object in the
+// `handle` attribute. The fields the calendar was built from are kept in the
+// protected slot of the pointer. A handle whose fields no longer match the
+// object's (fields modified by hand) is ignored and the calendar is rebuilt
+// for that call. A handle whose pointer is gone (the object was deserialized)
+// is rebuilt on first use and kept for the following calls.
+
+static SEXP calendar_fields(const Rcpp::List& calendar) {
+  int size = calendar.size();
+  Rcpp::List fields(size);
+
+  for (int i = 0; i < size; ++i) {
+    fields[i] = calendar[i];
+  }
+
+  return fields;
+}
+
+static void calendar_finalize(SEXP handle) {
+  QuantLib::Calendar* ql_calendar = static_cast<QuantLib::Calendar*>(R_ExternalPtrAddr(handle));
+
+  if (ql_calendar == NULL) {
+    return;
+  }
+
+  delete ql_calendar;
+  R_ClearExternalPtr(handle);
+}
+
+static void set_handle(SEXP handle, const QuantLib::Calendar& ql_calendar) {
+  R_SetExternalPtrAddr(handle, new QuantLib::Calendar(ql_calendar));
+  R_RegisterCFinalizerEx(handle, calendar_finalize, TRUE);
+}
+
+// Fields are usually the very objects the handle was built from. They are
+// only equal in value when the handle is shared by calendars built apart
+// from each other, or once the object was deserialized.
+static bool same_field(SEXP x, SEXP y) {
+  return x == y || R_compute_identical(x, y, 16);
+}
+
+static SEXP get_handle(const Rcpp::List& calendar) {
+  SEXP handle = Rf_getAttrib(calendar, Rf_install("handle"));
+
+  if (TYPEOF(handle) != EXTPTRSXP) {
+    return R_NilValue;
+  }
+
+  SEXP fields = R_ExternalPtrProtected(handle);
+  R_xlen_t size = Rf_xlength(calendar);
+
+  if (TYPEOF(fields) != VECSXP || Rf_xlength(fields) != size) {
+    return R_NilValue;
+  }
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    if (!same_field(VECTOR_ELT(fields, i), VECTOR_ELT(calendar, i))) {
+      return R_NilValue;
+    }
+  }
+
+  return handle;
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP calendar_compile(const Rcpp::List& calendar) {
+  QuantLib::Calendar ql_calendar = build_calendar(calendar);
+
+  SEXP fields = PROTECT(calendar_fields(calendar));
+  SEXP handle = PROTECT(R_MakeExternalPtr(NULL, R_NilValue, fields));
+
+  set_handle(handle, ql_calendar);
+
+  UNPROTECT(2);
+  return handle;
+}
+
+// [[Rcpp::export(rng=false)]]
+bool calendar_has_handle(const Rcpp::List& calendar) {
+  SEXP handle = get_handle(calendar);
+  return handle != R_NilValue && R_ExternalPtrAddr(handle) != NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+QuantLib::Calendar new_calendar(const Rcpp::List& calendar) {
+  SEXP handle = get_handle(calendar);
+
+  if (handle == R_NilValue) {
+    return build_calendar(calendar);
+  }
+
+  void* address = R_ExternalPtrAddr(handle);
+
+  if (address == NULL) {
+    QuantLib::Calendar ql_calendar = build_calendar(calendar);
+    set_handle(handle, ql_calendar);
+    return ql_calendar;
+  }
+
+  return *static_cast<const QuantLib::Calendar*>(address);
+}
+
 // -----------------------------------------------------------------------------
 // "empty" calendar support - with user defined weekends as well as holidays
-// Apparently you don't have to remove the weekends like you do the holidays
 
 static QuantLib::BespokeCalendar init_empty_calendar() {
   return QuantLib::BespokeCalendar();
@@ -142,12 +352,54 @@ static void add_weekends(QuantLib::BespokeCalendar calendar, const Rcpp::Integer
 static QuantLib::BespokeCalendar new_empty_calendar(const Rcpp::List& calendar) {
   QuantLib::BespokeCalendar empty_calendar = init_empty_calendar();
 
-  const Rcpp::DateVector added_holidays = calendar[1];
-  const Rcpp::DateVector removed_holidays = calendar[2];
+  SEXP added_holidays = calendar[1];
+  SEXP removed_holidays = calendar[2];
   const Rcpp::IntegerVector weekends = calendar[3];
 
   adjust_holidays(empty_calendar, added_holidays, removed_holidays);
   add_weekends(empty_calendar, weekends);
 
+  empty_calendar.compile();
+
   return empty_calendar;
 }
+
+// -----------------------------------------------------------------------------
+// "joint" calendar support - any number of calendars joined by a rule
+//
+// The members come out of `new_calendar()` compiled, from their handles when
+// they have one, so compiling the joint calendar combines their indexes a word
+// at a time rather than evaluating the rules of every member on every date.
+
+static QuantLib::Calendar new_joint_calendar(const Rcpp::List& calendar) {
+  const Rcpp::List calendars = calendar[3];
+  std::string rule = calendar[4];
+
+  int size = calendars.size();
+
+  if (size == 0) {
+    Rf_errorcall(R_NilValue, "A joint calendar needs at least one calendar.");
+  }
+
+  std::vector<QuantLib::Calendar> members;
+  members.reserve(size);
+
+  for (int i = 0; i < size; ++i) {
+    const Rcpp::List member = calendars[i];
+    members.push_back(new_calendar(member));
+  }
+
+  QuantLib::Calendar joint_calendar = QuantLib::JointCalendar(
+    members,
+    as_joint_calendar_rule(rule)
+  );
+
+  SEXP added_holidays = calendar[1];
+  SEXP removed_holidays = calendar[2];
+
+  adjust_holidays(joint_calendar, added_holidays, removed_holidays);
+
+  joint_calendar.compile();
+
+  return joint_calendar;
+}
@@ -1,7 +1,5 @@
 #include "almanac.h"
 
-static const unsigned int quantlib_to_r_offset_in_days = 25569;
-
 QuantLib::Date as_quantlib_date(const Rcpp::Date& date) {
   QuantLib::Date new_date;
 
@@ -24,6 +22,20 @@ Rcpp::Date as_r_date(const QuantLib::Date& date) {
   return new_date;
 }
 
+r_dates::r_dates(SEXP x) :
+  p_double_(NULL),
+  p_int_(NULL),
+  size_(Rf_xlength(x)) {
+
+  if (TYPEOF(x) == REALSXP) {
+    p_double_ = REAL(x);
+  } else if (TYPEOF(x) == INTSXP) {
+    p_int_ = INTEGER(x);
+  } else {
+    Rf_errorcall(R_NilValue, "Dates must be stored as doubles or integers.");
+  }
+}
+
 // -----------------------------------------------------------------------------
 // Datetimes are REALLY hard to get right, and I think they are going to be less
 // useful than the Dates + holidays, so lets ignore them. I don't think they are
@@ -1,187 +1,207 @@
 #include "almanac.h"
 #include "utils.h"
+#include "parallel.h"
+#include "unique.h"
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::DateVector calendar_adjust(const Rcpp::DateVector x,
+Rcpp::DateVector calendar_adjust(SEXP x,
                                  const std::string& convention,
                                  const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
   QuantLib::BusinessDayConvention ql_convention = as_business_day_convention(convention);
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
-  QuantLib::Date new_ql_date;
   Rcpp::DateVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  double* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_REAL;
-      continue;
-    }
+  if (use_unique_dates(size)) {
+    map_unique_dates(dates, p_out, NA_REAL, [&](const QuantLib::Date& ql_date) {
+      return as_r_double(ql_calendar.adjust(ql_date, ql_convention));
+    });
+
+    return out;
+  }
 
-    ql_date = as_quantlib_date(date);
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      if (i > begin && dates.repeats(i)) {
+        p_out[i] = p_out[i - 1];
+        continue;
+      }
 
-    new_ql_date = ql_calendar.adjust(ql_date, ql_convention);
+      QuantLib::Date ql_date = dates[i];
 
-    out[i] = as_r_date(new_ql_date);
-  }
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_REAL;
+        continue;
+      }
+
+      QuantLib::Date new_ql_date = ql_calendar.adjust(ql_date, ql_convention);
+
+      p_out[i] = as_r_double(new_ql_date);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::IntegerVector calendar_count(const Rcpp::DateVector& starts,
-                                   const Rcpp::DateVector& stops,
+Rcpp::IntegerVector calendar_count(SEXP starts,
+                                   SEXP stops,
                                    const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = starts.size();
+  r_dates start_dates(starts);
+  r_dates stop_dates(stops);
+  R_xlen_t size = start_dates.size();
 
-  Rcpp::Date start;
-  Rcpp::Date stop;
-  QuantLib::Date ql_start;
-  QuantLib::Date ql_stop;
   Rcpp::IntegerVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    start = starts[i];
+  int* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(start)) {
-      out[i] = NA_INTEGER;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date ql_start = start_dates[i];
 
-    stop = stops[i];
+      if (ql_start == QuantLib::Date()) {
+        p_out[i] = NA_INTEGER;
+        continue;
+      }
 
-    if (Rcpp::DateVector::is_na(stop)) {
-      out[i] = NA_INTEGER;
-      continue;
-    }
+      QuantLib::Date ql_stop = stop_dates[i];
 
-    ql_start = as_quantlib_date(start);
-    ql_stop = as_quantlib_date(stop);
+      if (ql_stop == QuantLib::Date()) {
+        p_out[i] = NA_INTEGER;
+        continue;
+      }
 
-    out[i] = ql_calendar.businessDaysBetween(ql_start, ql_stop, true, false);
-  }
+      p_out[i] = ql_calendar.businessDaysBetween(ql_start, ql_stop, true, false);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::LogicalVector calendar_is_weekend(const Rcpp::DateVector x,
+Rcpp::LogicalVector calendar_is_weekend(SEXP x,
                                         const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  // Bit `w - 1` is set iff weekday `w` is part of the weekend
+  const QuantLib::Natural mask = ql_calendar.weekendMask();
+
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
   Rcpp::LogicalVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  int* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_LOGICAL;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date ql_date = dates[i];
 
-    ql_date = as_quantlib_date(date);
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_LOGICAL;
+        continue;
+      }
 
-    out[i] = ql_calendar.isWeekend(ql_date.weekday());
-  }
+      p_out[i] = (mask >> (ql_date.weekday() - 1)) & 1;
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::LogicalVector calendar_is_business_day(const Rcpp::DateVector x,
+Rcpp::LogicalVector calendar_is_business_day(SEXP x,
                                              const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
   Rcpp::LogicalVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  int* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_LOGICAL;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      if (i > begin && dates.repeats(i)) {
+        p_out[i] = p_out[i - 1];
+        continue;
+      }
 
-    ql_date = as_quantlib_date(date);
+      QuantLib::Date ql_date = dates[i];
 
-    out[i] = ql_calendar.isBusinessDay(ql_date);
-  }
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_LOGICAL;
+        continue;
+      }
+
+      p_out[i] = ql_calendar.isBusinessDay(ql_date);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::LogicalVector calendar_is_holiday(const Rcpp::DateVector x,
+Rcpp::LogicalVector calendar_is_holiday(SEXP x,
                                         const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
   Rcpp::LogicalVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  int* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_LOGICAL;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date ql_date = dates[i];
 
-    ql_date = as_quantlib_date(date);
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_LOGICAL;
+        continue;
+      }
 
-    out[i] = ql_calendar.isHoliday(ql_date);
-  }
+      p_out[i] = ql_calendar.isHoliday(ql_date);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::LogicalVector calendar_is_end_of_month(const Rcpp::DateVector x,
+Rcpp::LogicalVector calendar_is_end_of_month(SEXP x,
                                              const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
   Rcpp::LogicalVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  int* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_LOGICAL;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date ql_date = dates[i];
 
-    ql_date = as_quantlib_date(date);
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_LOGICAL;
+        continue;
+      }
 
-    out[i] = ql_calendar.isEndOfMonth(ql_date);
-  }
+      p_out[i] = ql_calendar.isEndOfMonth(ql_date);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
@@ -1,34 +1,171 @@
 #include "almanac.h"
+#include "parallel.h"
 
-// [[Rcpp::export(rng=false)]]
-Rcpp::DateVector calendar_holidays_between(const Rcpp::DateVector& start,
-                                           const Rcpp::DateVector& stop,
-                                           const bool& weekends,
-                                           const Rcpp::List& calendar) {
-  if (Rcpp::DateVector::is_na(start[0]) || Rcpp::DateVector::is_na(stop[0])) {
-    Rcpp::DateVector out(0);
-    return out;
-  }
+// Holidays in `[from, to]`, written to a new Date vector. On a compiled
+// calendar the holidays are counted with the rank index first, so the
+// output is allocated at its exact size, and then filled by scanning the
+// set bits of the holiday words 64 days at a time.
+static Rcpp::DateVector holidays_between(const QuantLib::Date& from,
+                                         const QuantLib::Date& to,
+                                         bool weekends,
+                                         const QuantLib::Calendar& calendar) {
+  const QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex>& index =
+    calendar.index();
 
-  QuantLib::Calendar ql_calendar = new_calendar(calendar);
+  if (index && index->covers(from) && index->covers(to)) {
+    int size = index->holidayCount(from, to, weekends);
+    Rcpp::DateVector out(size);
 
-  QuantLib::Date ql_start = as_quantlib_date(start[0]);
-  QuantLib::Date ql_stop = as_quantlib_date(stop[0]);
+    double* p_out = out.begin();
+
+    index->forEachHoliday(from, to, weekends, [&](const QuantLib::Date& d) {
+      *p_out++ = as_r_double(d);
+    });
+
+    return out;
+  }
 
   std::vector<QuantLib::Date> ql_holidays = QuantLib::Calendar::holidayList(
-    ql_calendar,
-    ql_start,
-    ql_stop,
+    calendar,
+    from,
+    to,
     weekends
   );
 
   int size = ql_holidays.size();
   Rcpp::DateVector out(size);
 
+  double* p_out = out.begin();
+
   for (int i = 0; i < size; ++i) {
-    out[i] = as_r_date(ql_holidays[i]);
+    p_out[i] = as_r_double(ql_holidays[i]);
+  }
+
+  return out;
+}
+
+// `start` and `stop` have already been recycled to a common size. Returns
+// one Date vector of holidays per range, which is empty when either of its
+// boundaries is `NA`.
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List calendar_holidays_between(SEXP start,
+                                     SEXP stop,
+                                     const bool& weekends,
+                                     const Rcpp::List& calendar) {
+  QuantLib::Calendar ql_calendar = new_calendar(calendar);
+
+  r_dates starts(start);
+  r_dates stops(stop);
+  R_xlen_t size = starts.size();
+
+  Rcpp::List out(size);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    QuantLib::Date ql_start = starts[i];
+    QuantLib::Date ql_stop = stops[i];
+
+    if (ql_start == QuantLib::Date() || ql_stop == QuantLib::Date()) {
+      out[i] = Rcpp::DateVector(0);
+      continue;
+    }
+
+    out[i] = holidays_between(ql_start, ql_stop, weekends, ql_calendar);
+  }
+
+  return out;
+}
+
+// Every holiday in `[start, stop]` for each of the named market calendars.
+// Building a calendar evaluates its rules over the whole date range, which
+// dominates the cost, so the calendars are built and listed on worker
+// threads, one calendar per element. Markets whose rules are only defined
+// on part of the date range (the Moscow exchange before 2012) are listed
+// over that part. Names of the same market (such as a country and its
+// default market) give calendars that compare equal; each market is only
+// listed once and its holidays are shared by all of its names. This is only
+// to save work, as calendars sharing a rule index can be compiled on several
+// threads at once.
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List calendar_holidays_all_calendars(const std::vector<std::string>& names,
+                                           SEXP start,
+                                           SEXP stop,
+                                           const bool& weekends) {
+  r_dates starts(start);
+  r_dates stops(stop);
+
+  QuantLib::Date ql_start = starts[0];
+  QuantLib::Date ql_stop = stops[0];
+
+  R_xlen_t size = names.size();
+
+  std::vector<QuantLib::Calendar> calendars;
+  std::vector<R_xlen_t> locations(size);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    QuantLib::Calendar ql_calendar = init_calendar(names[i]);
+
+    std::vector<QuantLib::Calendar>::iterator it = std::find(
+      calendars.begin(),
+      calendars.end(),
+      ql_calendar
+    );
+
+    locations[i] = it - calendars.begin();
+
+    if (it == calendars.end()) {
+      calendars.push_back(ql_calendar);
+    }
+  }
+
+  R_xlen_t n_calendars = calendars.size();
+  std::vector< std::vector<QuantLib::Date> > holidays(n_calendars);
+
+  parallel_for(n_calendars, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      calendars[i].compile();
+
+      const QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex>& index =
+        calendars[i].index();
+
+      QuantLib::Date from = ql_start;
+      QuantLib::Date to = ql_stop;
+
+      if (index->covers(index->firstDate())) {
+        from = std::max(from, index->firstDate());
+        to = std::min(to, index->lastDate());
+      }
+
+      if (from >= to) {
+        continue;
+      }
+
+      holidays[i] = QuantLib::Calendar::holidayList(
+        calendars[i],
+        from,
+        to,
+        weekends
+      );
+    }
+  }, 1);
+
+  Rcpp::List out(size);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    const std::vector<QuantLib::Date>& elt_holidays = holidays[locations[i]];
+
+    int elt_size = elt_holidays.size();
+    Rcpp::DateVector elt(elt_size);
+
+    double* p_elt = elt.begin();
+
+    for (int j = 0; j < elt_size; ++j) {
+      p_elt[j] = as_r_double(elt_holidays[j]);
+    }
+
+    out[i] = elt;
   }
 
-  reset_calendar(ql_calendar);
   return out;
 }
@@ -0,0 +1,39 @@
+#include "parallel.h"
+
+// Reads `getOption("almanac.threads")`, which defaults to `1` so kernels
+// run serially unless asked otherwise
+static int threads_option() {
+  SEXP option = Rf_GetOption1(Rf_install("almanac.threads"));
+
+  if (Rf_isNull(option)) {
+    return 1;
+  }
+
+  if (!(Rf_isInteger(option) || Rf_isReal(option)) || Rf_length(option) != 1) {
+    Rf_errorcall(R_NilValue, "`almanac.threads` must be a single number.");
+  }
+
+  int threads = Rf_asInteger(option);
+
+  if (threads == NA_INTEGER || threads < 1) {
+    Rf_errorcall(R_NilValue, "`almanac.threads` must be a positive number.");
+  }
+
+  return threads;
+}
+
+int almanac_threads(R_xlen_t size, R_xlen_t grain_size) {
+  int threads = threads_option();
+
+  if (threads == 1) {
+    return 1;
+  }
+
+  R_xlen_t max_threads = size / grain_size;
+
+  if (max_threads < threads) {
+    threads = static_cast<int>(max_threads);
+  }
+
+  return threads < 1 ? 1 : threads;
+}
@@ -0,0 +1,89 @@
+#ifndef ALMANAC_PARALLEL_H
+#define ALMANAC_PARALLEL_H
+
+#include <Rcpp.h>
+#include <algorithm>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Parallel loops over the elements of a kernel's inputs
+//
+// `parallel_for(size, fn)` calls `fn(begin, end)` on contiguous chunks of
+// `[0, size)`, one per thread, and returns once every chunk is done. The
+// number of threads comes from `almanac_threads()`, which must be called
+// on the main thread, so it is resolved before any thread is started.
+//
+// `fn` runs outside of the main thread and must not touch the R API, which
+// includes allocating, `Rcpp::Date`, and anything that could call
+// `Rf_error()`. Kernels grab raw pointers to their input and output buffers
+// up front and only read and write through those. An exception thrown by a
+// chunk is rethrown on the main thread once all threads have finished.
+//
+// Inputs are only split when every thread gets at least `grain_size`
+// elements. The default suits the per-date kernels, where starting the
+// threads costs more than it saves below that. Callers doing much more
+// work per element pass a smaller grain.
+
+static const R_xlen_t default_grain_size = 10000;
+
+int almanac_threads(R_xlen_t size, R_xlen_t grain_size = default_grain_size);
+
+template <class F>
+void parallel_for(R_xlen_t size,
+                  const F& fn,
+                  R_xlen_t grain_size = default_grain_size) {
+  int n_threads = almanac_threads(size, grain_size);
+
+  if (n_threads <= 1) {
+    fn(0, size);
+    return;
+  }
+
+  R_xlen_t chunk_size = (size + n_threads - 1) / n_threads;
+
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> errors(n_threads);
+
+  threads.reserve(n_threads - 1);
+
+  for (int i = 0; i < n_threads; ++i) {
+    R_xlen_t begin = i * chunk_size;
+    R_xlen_t end = std::min(size, begin + chunk_size);
+
+    auto work = [&fn, &errors, i, begin, end]() {
+      try {
+        fn(begin, end);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    };
+
+    // The last chunk runs on the main thread, as do any chunks that we
+    // couldn't start a thread for
+    if (i == n_threads - 1) {
+      work();
+      continue;
+    }
+
+    try {
+      threads.push_back(std::thread(work));
+    } catch (const std::system_error&) {
+      work();
+    }
+  }
+
+  for (std::size_t i = 0; i < threads.size(); ++i) {
+    threads[i].join();
+  }
+
+  for (int i = 0; i < n_threads; ++i) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,132 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of almanac, and is not part of the QuantLib
+ distribution. It follows the QuantLib layout so that it can live
+ alongside the synced QuantLib sources.
+*/
+
+#include <ql/time/businessdayindex.hpp>
+#include <ql/errors.hpp>
+#include <algorithm>
+
+namespace QuantLib {
+
+    BusinessDayIndex::BusinessDayIndex(const Date& firstDate,
+                                       const std::vector<bool>& businessDays,
+                                       Natural weekendMask)
+    : first_(offset(firstDate)), span_(businessDays.size()),
+      weekendMask_(weekendMask),
+      words_((size() + 63) / 64, 0), weekends_(words_.size(), 0) {
+        QL_REQUIRE(first_ + span_ <= size(),
+                   "too many flags (" << span_ << ") given for the dates "
+                   "starting on " << firstDate);
+        for (Size i = 0; i < span_; ++i) {
+            if (businessDays[i])
+                set(first_ + i, true);
+        }
+        Weekday w = Date::minDate().weekday();
+        for (Size i = 0; i < size(); ++i) {
+            if ((weekendMask_ >> (w - 1)) & 1)
+                weekends_[i >> 6] |= word_type(1) << (i & 63);
+            w = (w == Saturday) ? Sunday : Weekday(w + 1);
+        }
+        buildRankSelect();
+    }
+
+    BusinessDayIndex::BusinessDayIndex(
+                                  const BusinessDayIndex& base,
+                                  const std::set<Date>& addedHolidays,
+                                  const std::set<Date>& removedHolidays)
+    : first_(base.first_), span_(base.span_),
+      weekendMask_(base.weekendMask_), words_(base.words_),
+      weekends_(base.weekends_) {
+        // holidays outside the covered range are left to the rules
+        std::set<Date>::const_iterator it;
+        for (it = addedHolidays.begin(); it != addedHolidays.end(); ++it) {
+            if (covers(*it))
+                set(offset(*it), false);
+        }
+        for (it = removedHolidays.begin(); it != removedHolidays.end(); ++it) {
+            if (covers(*it))
+                set(offset(*it), true);
+        }
+        buildRankSelect();
+    }
+
+    BusinessDayIndex::BusinessDayIndex(
+            const std::vector<ext::shared_ptr<const BusinessDayIndex> >&
+                                                                   indexes,
+            JoinRule rule) {
+        QL_REQUIRE(!indexes.empty(), "no indexes given");
+
+        const BusinessDayIndex& front = *indexes.front();
+        Size first = front.first_, last = front.first_ + front.span_;
+        weekendMask_ = front.weekendMask_;
+        words_ = front.words_;
+        weekends_ = front.weekends_;
+        for (Size k = 1; k < indexes.size(); ++k) {
+            const BusinessDayIndex& index = *indexes[k];
+            first = std::max(first, index.first_);
+            last = std::min(last, index.first_ + index.span_);
+            for (Size w = 0; w < words_.size(); ++w) {
+                if (rule == Intersection) {
+                    words_[w] &= index.words_[w];
+                    weekends_[w] |= index.weekends_[w];
+                } else {
+                    words_[w] |= index.words_[w];
+                    weekends_[w] &= index.weekends_[w];
+                }
+            }
+            if (rule == Intersection)
+                weekendMask_ |= index.weekendMask_;
+            else
+                weekendMask_ &= index.weekendMask_;
+        }
+        first_ = first;
+        span_ = last > first ? last - first : 0;
+
+        // with a union, a date covered by one of the indexes only can
+        // still have its bit set; clear everything outside the range
+        for (Size i = 0; i < first_; ++i)
+            set(i, false);
+        for (Size i = first_ + span_; i < size(); ++i)
+            set(i, false);
+        buildRankSelect();
+    }
+
+    Size BusinessDayIndex::size() {
+        return static_cast<Size>(Date::maxDate() - Date::minDate()) + 1;
+    }
+
+    void BusinessDayIndex::buildRankSelect() {
+        ranks_.resize(words_.size());
+        holidayRanks_.resize(words_.size());
+        boost::uint32_t count = 0, holidays = 0;
+        for (Size w = 0; w < words_.size(); ++w) {
+            ranks_[w] = count;
+            count += static_cast<boost::uint32_t>(popcount(words_[w]));
+            holidayRanks_[w] = holidays;
+            holidays += static_cast<boost::uint32_t>(popcount(holidayWord(w)));
+        }
+
+        count_ = count;
+
+        samples_.clear();
+        samples_.reserve((count_ + 63) / 64);
+        for (Size w = 0; w < words_.size(); ++w) {
+            // samples whose business day falls in this word
+            while (samples_.size() * 64 < ranks_[w] + popcount(words_[w]))
+                samples_.push_back(static_cast<boost::uint32_t>(w));
+        }
+    }
+
+    void BusinessDayIndex::set(Size i, bool businessDay) {
+        word_type mask = word_type(1) << (i & 63);
+        if (businessDay)
+            words_[i >> 6] |= mask;
+        else
+            words_[i >> 6] &= ~mask;
+    }
+
+}
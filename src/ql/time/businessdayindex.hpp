@@ -0,0 +1,389 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of almanac, and is not part of the QuantLib
+ distribution. It follows the QuantLib layout so that it can live
+ alongside the synced QuantLib sources.
+*/
+
+/*! \file businessdayindex.hpp
+    \brief compiled business-day lookup table
+*/
+
+#ifndef quantlib_business_day_index_hpp
+#define quantlib_business_day_index_hpp
+
+#include <ql/time/date.hpp>
+#include <ql/time/weekday.hpp>
+#include <ql/shared_ptr.hpp>
+#include <boost/cstdint.hpp>
+#include <set>
+#include <vector>
+
+namespace QuantLib {
+
+    //! compiled business-day lookup table
+    /*! This class stores one bit for every date in the range
+        [Date::minDate(), Date::maxDate()], set iff the date is a
+        business day. Once built, checking a date costs a single bit
+        test instead of an evaluation of the calendar rules.
+
+        Some calendars are only defined on part of the date range
+        (e.g., the Moscow exchange before 2012); the index then only
+        covers the dates on which the rules could be evaluated, and
+        callers are expected to fall back on the rules elsewhere.
+
+        Alongside the business days, the index keeps a mask of the
+        weekend days, so that holidays falling outside of the weekend
+        can be counted with the same rank lookups as business days.
+
+        The index is immutable; it is built once from the rules of a
+        calendar and then shared by every calendar compiled from it.
+
+        \ingroup datetime
+    */
+    class BusinessDayIndex {
+      public:
+        typedef boost::uint64_t word_type;
+        //! how the business days of joined indexes are combined
+        enum JoinRule { Intersection, //!< business days of every index
+                        Union         //!< business days of any index
+        };
+        //! \name constructors
+        //@{
+        /*! Builds the index from one flag per date, starting at the
+            given date, and from the weekend as returned by
+            Calendar::weekendMask(). Dates after the last flag are not
+            covered.
+        */
+        BusinessDayIndex(const Date& firstDate,
+                         const std::vector<bool>& businessDays,
+                         Natural weekendMask);
+        /*! Builds the index from an existing one, marking the added
+            holidays as holidays and the removed holidays as
+            business days.
+        */
+        BusinessDayIndex(const BusinessDayIndex& base,
+                         const std::set<Date>& addedHolidays,
+                         const std::set<Date>& removedHolidays);
+        /*! Builds the index of a joint calendar from the indexes of
+            its members, combining their words with a bitwise and (for
+            an intersection) or or (for a union); the weekend is
+            combined the opposite way. Only the dates covered by every
+            index are covered.
+            \pre at least one index must be given
+        */
+        BusinessDayIndex(
+            const std::vector<ext::shared_ptr<const BusinessDayIndex> >&
+                                                                   indexes,
+            JoinRule rule);
+        //@}
+        //! \name inspectors
+        //@{
+        //! whether the given date was evaluated when building the index
+        bool covers(const Date& d) const;
+        //! first date evaluated when building the index
+        Date firstDate() const;
+        //! last date evaluated when building the index
+        /*! \pre the index must cover at least one date */
+        Date lastDate() const;
+        /*! \pre the date must be covered by the index */
+        bool isBusinessDay(const Date& d) const;
+        //! whether the date falls on the weekend
+        bool isWeekend(const Date& d) const;
+        //! the weekend, with bit w-1 set iff weekday w is part of it
+        Natural weekendMask() const;
+        //! number of business days in [Date::minDate(), d)
+        /*! \pre the date must be covered by the index */
+        Size rank(const Date& d) const;
+        //! the k-th business day in the index, counting from zero
+        /*! This is the inverse of rank(), i.e., rank(select(k)) == k.
+            The word holding every 64th business day is sampled; the
+            k-th one is found from the sample before it by walking
+            the word ranks and then the bits of a single word.
+            \pre k must be less than count()
+        */
+        Date select(Size k) const;
+        //! total number of business days in the index
+        Size count() const;
+        //! first business day on or after the given date
+        /*! Returns a null date if the index holds no such date.
+            \pre the date must be covered by the index
+        */
+        Date nextBusinessDay(const Date& d) const;
+        //! last business day on or before the given date
+        /*! Returns a null date if the index holds no such date.
+            \pre the date must be covered by the index
+        */
+        Date previousBusinessDay(const Date& d) const;
+        //! number of holidays in [from, to]
+        /*! Weekend days are only counted if includeWeekEnds is true.
+            \pre both dates must be covered by the index, and from
+                 must not be later than to
+        */
+        Size holidayCount(const Date& from,
+                          const Date& to,
+                          bool includeWeekEnds = false) const;
+        //! calls f on each holiday in [from, to], in increasing order
+        /*! Holidays are found 64 dates at a time by scanning the set
+            bits of the complemented business-day words, so the cost
+            grows with the number of holidays rather than of dates.
+            Weekend days are only visited if includeWeekEnds is true.
+            \pre both dates must be covered by the index
+        */
+        template <class F>
+        void forEachHoliday(const Date& from,
+                            const Date& to,
+                            bool includeWeekEnds,
+                            F f) const;
+        //! calls f on each business day in [from, to], in increasing order
+        /*! \pre both dates must be covered by the index */
+        template <class F>
+        void forEachBusinessDay(const Date& from,
+                                const Date& to,
+                                F f) const;
+        //! number of dates in [Date::minDate(), Date::maxDate()]
+        static Size size();
+        //@}
+      private:
+        static Size offset(const Date& d);
+        static Size popcount(word_type w);
+        static Size ctz(word_type w);
+        static Size clz(word_type w);
+        // position of the r-th set bit of w, counting from zero
+        static Size selectInWord(word_type w, Size r);
+        void set(Size i, bool businessDay);
+        void buildRankSelect();
+        // holidays outside of the weekend, uncovered dates included
+        word_type holidayWord(Size w) const;
+        Size holidayRank(Size i) const;
+        // covered offsets are [first_, first_ + span_)
+        Size first_, span_;
+        Natural weekendMask_;
+        std::vector<word_type> words_;
+        // weekend days, over the whole date range
+        std::vector<word_type> weekends_;
+        // business days before the start of each word
+        std::vector<boost::uint32_t> ranks_;
+        // holidays outside of the weekend before the start of each word;
+        // these also count uncovered dates, which cancel out between
+        // any two covered ones
+        std::vector<boost::uint32_t> holidayRanks_;
+        // word holding each 64th business day, starting from the first
+        std::vector<boost::uint32_t> samples_;
+        Size count_;
+    };
+
+
+    // inline definitions
+
+    inline Size BusinessDayIndex::offset(const Date& d) {
+        static const Date::serial_type first =
+            Date::minDate().serialNumber();
+        return static_cast<Size>(d.serialNumber() - first);
+    }
+
+    inline bool BusinessDayIndex::covers(const Date& d) const {
+        // relies on unsigned wrap-around for dates before first_
+        return offset(d) - first_ < span_;
+    }
+
+    inline Date BusinessDayIndex::firstDate() const {
+        return Date::minDate() + static_cast<Date::serial_type>(first_);
+    }
+
+    inline Date BusinessDayIndex::lastDate() const {
+        return firstDate() + static_cast<Date::serial_type>(span_ - 1);
+    }
+
+    inline bool BusinessDayIndex::isBusinessDay(const Date& d) const {
+        Size i = offset(d);
+        return ((words_[i >> 6] >> (i & 63)) & 1) != 0;
+    }
+
+    inline bool BusinessDayIndex::isWeekend(const Date& d) const {
+        Size i = offset(d);
+        return ((weekends_[i >> 6] >> (i & 63)) & 1) != 0;
+    }
+
+    inline Natural BusinessDayIndex::weekendMask() const {
+        return weekendMask_;
+    }
+
+    inline Size BusinessDayIndex::rank(const Date& d) const {
+        Size i = offset(d);
+        word_type before = (word_type(1) << (i & 63)) - 1;
+        return ranks_[i >> 6] + popcount(words_[i >> 6] & before);
+    }
+
+    inline Date BusinessDayIndex::select(Size k) const {
+        Size w = samples_[k >> 6];
+        while (w + 1 < ranks_.size() && ranks_[w + 1] <= k)
+            ++w;
+        return Date::minDate() + static_cast<Date::serial_type>(
+            (w << 6) + selectInWord(words_[w], k - ranks_[w]));
+    }
+
+    inline Size BusinessDayIndex::count() const {
+        return count_;
+    }
+
+    // business days are only set on covered dates, so both scans
+    // stop at the first business day whatever the coverage
+
+    inline Date BusinessDayIndex::nextBusinessDay(const Date& d) const {
+        Size i = offset(d), w = i >> 6;
+        word_type bits = words_[w] & ~((word_type(1) << (i & 63)) - 1);
+        while (bits == 0) {
+            if (++w == words_.size())
+                return Date();
+            bits = words_[w];
+        }
+        return Date::minDate() +
+            static_cast<Date::serial_type>((w << 6) + ctz(bits));
+    }
+
+    inline Date BusinessDayIndex::previousBusinessDay(const Date& d) const {
+        Size i = offset(d), w = i >> 6;
+        // wraps around to a full mask for the last bit of a word
+        word_type bits = words_[w] & ((word_type(2) << (i & 63)) - 1);
+        while (bits == 0) {
+            if (w == 0)
+                return Date();
+            bits = words_[--w];
+        }
+        return Date::minDate() +
+            static_cast<Date::serial_type>((w << 6) + 63 - clz(bits));
+    }
+
+    inline BusinessDayIndex::word_type
+    BusinessDayIndex::holidayWord(Size w) const {
+        return ~words_[w] & ~weekends_[w];
+    }
+
+    inline Size BusinessDayIndex::holidayRank(Size i) const {
+        word_type before = (word_type(1) << (i & 63)) - 1;
+        return holidayRanks_[i >> 6] + popcount(holidayWord(i >> 6) & before);
+    }
+
+    inline Size BusinessDayIndex::holidayCount(const Date& from,
+                                               const Date& to,
+                                               bool includeWeekEnds) const {
+        Size days = static_cast<Size>(to - from) + 1;
+        if (includeWeekEnds) {
+            Size businessDays =
+                rank(to) + (isBusinessDay(to) ? 1 : 0) - rank(from);
+            return days - businessDays;
+        }
+        Size i = offset(from), j = offset(to);
+        Size last = (holidayWord(j >> 6) >> (j & 63)) & 1;
+        return holidayRank(j) + last - holidayRank(i);
+    }
+
+    template <class F>
+    void BusinessDayIndex::forEachHoliday(const Date& from,
+                                          const Date& to,
+                                          bool includeWeekEnds,
+                                          F f) const {
+        static const Date::serial_type first =
+            Date::minDate().serialNumber();
+
+        if (from > to)
+            return;
+        Size i = offset(from), j = offset(to);
+        for (Size w = i >> 6; w <= (j >> 6); ++w) {
+            word_type bits =
+                includeWeekEnds ? ~words_[w] : holidayWord(w);
+            if (w == (i >> 6))
+                bits &= ~((word_type(1) << (i & 63)) - 1);
+            if (w == (j >> 6) && (j & 63) != 63)
+                bits &= (word_type(2) << (j & 63)) - 1;
+            while (bits != 0) {
+                Size k = (w << 6) + ctz(bits);
+                f(Date(first + static_cast<Date::serial_type>(k)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    template <class F>
+    void BusinessDayIndex::forEachBusinessDay(const Date& from,
+                                              const Date& to,
+                                              F f) const {
+        static const Date::serial_type first =
+            Date::minDate().serialNumber();
+
+        if (from > to)
+            return;
+        Size i = offset(from), j = offset(to);
+        for (Size w = i >> 6; w <= (j >> 6); ++w) {
+            word_type bits = words_[w];
+            if (w == (i >> 6))
+                bits &= ~((word_type(1) << (i & 63)) - 1);
+            if (w == (j >> 6) && (j & 63) != 63)
+                bits &= (word_type(2) << (j & 63)) - 1;
+            while (bits != 0) {
+                Size k = (w << 6) + ctz(bits);
+                f(Date(first + static_cast<Date::serial_type>(k)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    inline Size BusinessDayIndex::popcount(word_type w) {
+        #if defined(__GNUC__)
+        return static_cast<Size>(__builtin_popcountll(w));
+        #else
+        w = w - ((w >> 1) & 0x5555555555555555ULL);
+        w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+        w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<Size>((w * 0x0101010101010101ULL) >> 56);
+        #endif
+    }
+
+    // w must not be zero
+    inline Size BusinessDayIndex::ctz(word_type w) {
+        #if defined(__GNUC__)
+        return static_cast<Size>(__builtin_ctzll(w));
+        #else
+        return popcount((w & (~w + 1)) - 1);
+        #endif
+    }
+
+    // w must not be zero
+    inline Size BusinessDayIndex::clz(word_type w) {
+        #if defined(__GNUC__)
+        return static_cast<Size>(__builtin_clzll(w));
+        #else
+        w |= w >> 1;
+        w |= w >> 2;
+        w |= w >> 4;
+        w |= w >> 8;
+        w |= w >> 16;
+        w |= w >> 32;
+        return 64 - popcount(w);
+        #endif
+    }
+
+    // w must have more than r set bits
+    inline Size BusinessDayIndex::selectInWord(word_type w, Size r) {
+        // skip whole bytes, then drop the lowest set bits of the
+        // byte holding the wanted one
+        Size shift = 0;
+        for (;;) {
+            Size bits = popcount((w >> shift) & 0xFF);
+            if (r < bits)
+                break;
+            r -= bits;
+            shift += 8;
+        }
+        word_type bits = w >> shift;
+        while (r-- > 0)
+            bits &= bits - 1;
+        return shift + ctz(bits);
+    }
+
+}
+
+
+#endif
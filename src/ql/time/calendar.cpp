@@ -22,11 +22,108 @@
 
 #include <ql/time/calendar.hpp>
 #include <ql/errors.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
+    namespace {
+
+        // step a date by one day, skipping the range check while
+        // there is room left before the end of the date range; past
+        // that, the checked operators throw their usual error
+        void nextDay(Date& d, Date::serial_type& room) {
+            if (room > 0) {
+                --room;
+                d.uncheckedIncrement();
+            } else {
+                ++d;
+            }
+        }
+
+        void previousDay(Date& d, Date::serial_type& room) {
+            if (room > 0) {
+                --room;
+                d.uncheckedDecrement();
+            } else {
+                --d;
+            }
+        }
+
+        class DateAppender {
+          public:
+            explicit DateAppender(std::vector<Date>& result)
+            : result_(result) {}
+            void operator()(const Date& d) const { result_.push_back(d); }
+          private:
+            std::vector<Date>& result_;
+        };
+
+    }
+
+    ext::shared_ptr<const BusinessDayIndex> Calendar::Impl::ruleIndex() const {
+        // if building throws, the next call tries again
+        std::call_once(ruleIndexFlag_, &Impl::setRuleIndex, this);
+        return ruleIndex_;
+    }
+
+    void Calendar::Impl::setRuleIndex() const {
+        ruleIndex_ = buildRuleIndex();
+    }
+
+    ext::shared_ptr<const BusinessDayIndex>
+    Calendar::Impl::buildRuleIndex() const {
+        // some rules are only defined on part of the date range
+        // and fail elsewhere; index the first run of dates on
+        // which they can be evaluated
+        Date::serial_type first = Date::minDate().serialNumber();
+        Date::serial_type last = Date::maxDate().serialNumber();
+        std::vector<bool> businessDays;
+        businessDays.reserve(BusinessDayIndex::size());
+        for (Date::serial_type s = first; s <= last; ++s) {
+            bool isBusiness;
+            try {
+                isBusiness = isBusinessDay(Date(s));
+            } catch (Error&) {
+                if (!businessDays.empty())
+                    break;
+                ++first;
+                continue;
+            }
+            businessDays.push_back(isBusiness);
+        }
+        return ext::make_shared<BusinessDayIndex>(
+            Date(std::min(first, last)), businessDays, weekendMask());
+    }
+
+    bool Calendar::Impl::hasRuleIndex() const {
+        return ruleIndex_ != 0;
+    }
+
+    void Calendar::compile() {
+        QL_REQUIRE(impl_, "no implementation provided");
+
+        ext::shared_ptr<const BusinessDayIndex> rules = impl_->ruleIndex();
+
+        // plain calendars share the rule index of their implementation
+        if (!overlay_)
+            index_ = rules;
+        else
+            index_ = ext::make_shared<BusinessDayIndex>(
+                *rules, overlay_->addedHolidays, overlay_->removedHolidays);
+    }
+
+    ext::shared_ptr<Calendar::Overlay> Calendar::amendOverlay() {
+        if (!overlay_)
+            overlay_ = ext::make_shared<Overlay>();
+        else if (overlay_.use_count() > 1)
+            overlay_ = ext::make_shared<Overlay>(*overlay_);
+        index_.reset();
+        return overlay_;
+    }
+
     void Calendar::addHoliday(const Date& d) {
         QL_REQUIRE(impl_, "no implementation provided");
+        ext::shared_ptr<Overlay> overlay = amendOverlay();
 
 #ifdef QL_HIGH_RESOLUTION_DATE
         const Date _d(d.dayOfMonth(), d.month(), d.year());
@@ -35,15 +132,16 @@ namespace QuantLib {
 #endif
 
         // if d was a genuine holiday previously removed, revert the change
-        impl_->removedHolidays.erase(_d);
+        overlay->removedHolidays.erase(_d);
         // if it's already a holiday, leave the calendar alone.
         // Otherwise, add it.
         if (impl_->isBusinessDay(_d))
-            impl_->addedHolidays.insert(_d);
+            overlay->addedHolidays.insert(_d);
     }
 
     void Calendar::removeHoliday(const Date& d) {
         QL_REQUIRE(impl_, "no implementation provided");
+        ext::shared_ptr<Overlay> overlay = amendOverlay();
 
 #ifdef QL_HIGH_RESOLUTION_DATE
         const Date _d(d.dayOfMonth(), d.month(), d.year());
@@ -52,11 +150,11 @@ namespace QuantLib {
 #endif
 
         // if d was an artificially-added holiday, revert the change
-        impl_->addedHolidays.erase(_d);
+        overlay->addedHolidays.erase(_d);
         // if it's already a business day, leave the calendar alone.
         // Otherwise, add it.
         if (!impl_->isBusinessDay(_d))
-            impl_->removedHolidays.insert(_d);
+            overlay->removedHolidays.insert(_d);
     }
 
     Date Calendar::adjust(const Date& d,
@@ -66,11 +164,52 @@ namespace QuantLib {
         if (c == Unadjusted)
             return d;
 
+        if (index_ && index_->covers(d)) {
+            Date following = index_->nextBusinessDay(d);
+            Date preceding = index_->previousBusinessDay(d);
+            Date result;
+            switch (c) {
+              case Following:
+                result = following;
+                break;
+              case ModifiedFollowing:
+              case HalfMonthModifiedFollowing:
+                result = following;
+                if (following != Date()
+                    && (following.month() != d.month()
+                        || (c == HalfMonthModifiedFollowing
+                            && d.dayOfMonth() <= 15
+                            && following.dayOfMonth() > 15)))
+                    result = preceding;
+                break;
+              case Preceding:
+                result = preceding;
+                break;
+              case ModifiedPreceding:
+                result = preceding;
+                if (preceding != Date() && preceding.month() != d.month())
+                    result = following;
+                break;
+              case Nearest:
+                if (following != Date() && preceding != Date())
+                    result = (following - d <= d - preceding) ?
+                        following : preceding;
+                break;
+              default:
+                QL_FAIL("unknown business-day convention");
+            }
+            // a null result means the adjusted date lies outside of
+            // the index and has to be found by the rules below
+            if (result != Date())
+                return result;
+        }
+
         Date d1 = d;
         if (c == Following || c == ModifiedFollowing 
             || c == HalfMonthModifiedFollowing) {
+            Date::serial_type room = Date::maxDate() - d1;
             while (isHoliday(d1))
-                d1++;
+                nextDay(d1, room);
             if (c == ModifiedFollowing 
                 || c == HalfMonthModifiedFollowing) {
                 if (d1.month() != d.month()) {
@@ -83,17 +222,20 @@ namespace QuantLib {
                 }
             }
         } else if (c == Preceding || c == ModifiedPreceding) {
+            Date::serial_type room = d1 - Date::minDate();
             while (isHoliday(d1))
-                d1--;
+                previousDay(d1, room);
             if (c == ModifiedPreceding && d1.month() != d.month()) {
                 return adjust(d,Following);
             }
         } else if (c == Nearest) {
             Date d2 = d;
+            Date::serial_type room1 = Date::maxDate() - d1;
+            Date::serial_type room2 = d2 - Date::minDate();
             while (isHoliday(d1) && isHoliday(d2))
             {
-                d1++;
-                d2--;
+                nextDay(d1, room1);
+                previousDay(d2, room2);
             }
             if (isHoliday(d1))
                 return d2;
@@ -113,19 +255,35 @@ namespace QuantLib {
         if (n == 0) {
             return adjust(d,c);
         } else if (unit == Days) {
+            if (index_ && index_->covers(d)) {
+                // rank of d, then select the business day n away
+                Size before = index_->rank(d);
+                if (n > 0) {
+                    Size k = before + (index_->isBusinessDay(d) ? 1 : 0)
+                        + Size(n - 1);
+                    if (k < index_->count())
+                        return index_->select(k);
+                } else if (before >= Size(-n)) {
+                    return index_->select(before - Size(-n));
+                }
+                // otherwise the result lies outside of the index and
+                // the rules below will have to find it (or fail)
+            }
             Date d1 = d;
             if (n > 0) {
+                Date::serial_type room = Date::maxDate() - d1;
                 while (n > 0) {
-                    d1++;
+                    nextDay(d1, room);
                     while (isHoliday(d1))
-                        d1++;
+                        nextDay(d1, room);
                     n--;
                 }
             } else {
+                Date::serial_type room = d1 - Date::minDate();
                 while (n < 0) {
-                    d1--;
+                    previousDay(d1, room);
                     while(isHoliday(d1))
-                        d1--;
+                        previousDay(d1, room);
                     n++;
                 }
             }
@@ -157,21 +315,23 @@ namespace QuantLib {
                                                     bool includeLast) const {
         Date::serial_type wd = 0;
         if (from != to) {
-            if (from < to) {
-                // the last one is treated separately to avoid
-                // incrementing Date::maxDate()
-                for (Date d = from; d < to; ++d) {
-                    if (isBusinessDay(d))
-                        ++wd;
-                }
-                if (isBusinessDay(to))
+            const Date& first = (from < to) ? from : to;
+            const Date& last = (from < to) ? to : from;
+            if (index_ && index_->covers(first) && index_->covers(last)) {
+                // business days in [first, last] from the rank index
+                wd = static_cast<Date::serial_type>(
+                    index_->rank(last) - index_->rank(first));
+                if (index_->isBusinessDay(last))
                     ++wd;
-            } else if (from > to) {
-                for (Date d = to; d < from; ++d) {
+            } else {
+                // the last one is treated separately to avoid
+                // incrementing Date::maxDate(); all of the others lie
+                // between two valid dates and need no range check
+                for (Date d = first; d < last; d.uncheckedIncrement()) {
                     if (isBusinessDay(d))
                         ++wd;
                 }
-                if (isBusinessDay(from))
+                if (isBusinessDay(last))
                     ++wd;
             }
 
@@ -193,9 +353,8 @@ namespace QuantLib {
 
    // Western calendars
 
-    bool Calendar::WesternImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
+    Calendar::WesternImpl::WesternImpl()
+    : Impl(weekendOf(Saturday, Sunday)) {}
 
     Day Calendar::WesternImpl::easterMonday(Year y) {
         static const Day EasterMonday[] = {
@@ -235,9 +394,8 @@ namespace QuantLib {
 
     // Orthodox calendars
 
-    bool Calendar::OrthodoxImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
+    Calendar::OrthodoxImpl::OrthodoxImpl()
+    : Impl(weekendOf(Saturday, Sunday)) {}
 
     Day Calendar::OrthodoxImpl::easterMonday(Year y) {
         static const Day EasterMonday[] = {
@@ -283,7 +441,18 @@ namespace QuantLib {
             << from << ") must be earlier than 'to' date ("
             << to << ")");
         std::vector<Date> result;
-        for (Date d = from; d <= to; ++d) {
+        const ext::shared_ptr<const BusinessDayIndex>& index =
+            calendar.index_;
+        if (index && index->covers(from) && index->covers(to)) {
+            // sized by popcount, then filled by scanning the bits
+            result.reserve(index->holidayCount(from, to, includeWeekEnds));
+            index->forEachHoliday(from, to, includeWeekEnds,
+                                  DateAppender(result));
+            return result;
+        }
+        // every date up to 'to' is valid, and the one past it is
+        // only compared against it
+        for (Date d = from; d <= to; d.uncheckedIncrement()) {
             if (calendar.isHoliday(d)
                 && (includeWeekEnds || !calendar.isWeekend(d.weekday())))
                 result.push_back(d);
@@ -291,4 +460,27 @@ namespace QuantLib {
        return result;
     }
 
+    std::vector<Date> Calendar::businessDayList(const Calendar& calendar,
+        const Date& from, const Date& to) {
+
+        std::vector<Date> result;
+        if (from > to)
+            return result;
+        const ext::shared_ptr<const BusinessDayIndex>& index =
+            calendar.index_;
+        if (index && index->covers(from) && index->covers(to)) {
+            // sized by rank, then filled by scanning the bits
+            Size first = index->rank(from);
+            Size last = index->rank(to) + (index->isBusinessDay(to) ? 1 : 0);
+            result.reserve(last - first);
+            index->forEachBusinessDay(from, to, DateAppender(result));
+        } else {
+            for (Date d = from; d <= to; d.uncheckedIncrement()) {
+                if (calendar.isBusinessDay(d))
+                    result.push_back(d);
+            }
+        }
+        return result;
+    }
+
 }
@@ -29,7 +29,9 @@
 #include <ql/errors.hpp>
 #include <ql/time/date.hpp>
 #include <ql/time/businessdayconvention.hpp>
+#include <ql/time/businessdayindex.hpp>
 #include <ql/shared_ptr.hpp>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <string>
@@ -64,10 +66,63 @@ namespace QuantLib {
             virtual ~Impl() {}
             virtual std::string name() const = 0;
             virtual bool isBusinessDay(const Date&) const = 0;
-            virtual bool isWeekend(Weekday) const = 0;
+            bool isWeekend(Weekday) const;
+            //! the weekend, with bit w-1 set iff weekday w is part of it
+            Natural weekendMask() const;
+            //! index of the business days given by the rules alone
+            /*! The index is built on first use and kept for the
+                lifetime of the implementation. Calendars sharing the
+                implementation can be compiled from several threads
+                at once; the index is then built by one of them while
+                the others wait for it.
+            */
+            ext::shared_ptr<const BusinessDayIndex> ruleIndex() const;
+          protected:
+            //! implementations give their weekend on construction
+            explicit Impl(Natural weekendMask);
+            //! the mask of a weekend made of the two given days
+            static Natural weekendOf(Weekday, Weekday);
+            //! whether the rule index was built
+            /*! Once it is, compiled calendars rely on it and the
+                rules must no longer change.
+
+                \warning this is not synchronized with ruleIndex();
+                         like any change of the rules, it must not
+                         run while calendars are being compiled.
+            */
+            bool hasRuleIndex() const;
+            //! builds the rule index, by default by evaluating the rules
+            /*! Implementations able to derive the index more cheaply
+                (e.g., from the indexes of other calendars) can
+                override this method.
+            */
+            virtual ext::shared_ptr<const BusinessDayIndex>
+            buildRuleIndex() const;
+            /*! Implementations can only change their weekend until
+                the rule index is built.
+            */
+            Natural weekendMask_;
+          private:
+            void setRuleIndex() const;
+            mutable std::once_flag ruleIndexFlag_;
+            mutable ext::shared_ptr<const BusinessDayIndex> ruleIndex_;
+        };
+        //! holidays added to or removed from the rules
+        /*! The overlay belongs to the calendar instance rather than
+            to its implementation, which is shared by every calendar
+            of the same market. Copies of a calendar share it until
+            one of them adds or removes a holiday, which first makes
+            a private copy; calendars can therefore be changed and
+            used independently of each other.
+        */
+        struct Overlay {
             std::set<Date> addedHolidays, removedHolidays;
         };
         ext::shared_ptr<Impl> impl_;
+        ext::shared_ptr<Overlay> overlay_;
+        ext::shared_ptr<const BusinessDayIndex> index_;
+      private:
+        ext::shared_ptr<Overlay> amendOverlay();
       public:
         /*! The default constructor returns a calendar with a null
             implementation, which is therefore unusable except as a
@@ -103,6 +158,12 @@ namespace QuantLib {
             weekend for the given market.
         */
         bool isWeekend(Weekday w) const;
+        /*! Returns the weekend as a mask of seven bits, bit w-1 being
+            set iff weekday w is part of the weekend for the given
+            market; a compiled calendar returns it without calling into
+            its rules.
+        */
+        Natural weekendMask() const;
         /*! Returns <tt>true</tt> iff in the given market, the date is on
             or after the last business day for that month.
         */
@@ -115,11 +176,28 @@ namespace QuantLib {
         /*! Removes a date from the set of holidays for the given calendar. */
         void removeHoliday(const Date&);
 
+        /*! Compiles the current rules and holidays into a business-day
+            index, after which business-day checks are table lookups.
+            Adding or removing a holiday discards the index.
+        */
+        void compile();
+        //! Returns whether or not the calendar is compiled
+        bool compiled() const;
+        /*! Returns the index built by compile(), or a null pointer if
+            the calendar is not compiled. The index stays valid for as
+            long as it is held, even if the calendar changes.
+        */
+        const ext::shared_ptr<const BusinessDayIndex>& index() const;
+
         //! Returns the holidays between two dates
         static std::vector<Date> holidayList(const Calendar& calendar,
                                              const Date& from,
                                              const Date& to,
                                              bool includeWeekEnds = false);
+        //! Returns the business days between two dates, both included
+        static std::vector<Date> businessDayList(const Calendar& calendar,
+                                                 const Date& from,
+                                                 const Date& to);
 
         /*! Adjusts a non-business day to the appropriate near business day
             with respect to the given convention.
@@ -160,7 +238,7 @@ namespace QuantLib {
         */
         class WesternImpl : public Impl {
           public:
-            bool isWeekend(Weekday) const;
+            WesternImpl();
             //! expressed relative to first day of year
             static Day easterMonday(Year);
         };
@@ -171,7 +249,7 @@ namespace QuantLib {
         */
         class OrthodoxImpl : public Impl {
           public:
-            bool isWeekend(Weekday) const;
+            OrthodoxImpl();
             //! expressed relative to first day of year
             static Day easterMonday(Year);
         };
@@ -203,15 +281,29 @@ namespace QuantLib {
 
     inline const std::set<Date>& Calendar::addedHolidays() const {
         QL_REQUIRE(impl_, "no implementation provided");
-        return impl_->addedHolidays;
+        static const std::set<Date> none;
+        return overlay_ ? overlay_->addedHolidays : none;
     }
 
     inline const std::set<Date>& Calendar::removedHolidays() const {
         QL_REQUIRE(impl_, "no implementation provided");
-        return impl_->removedHolidays;
+        static const std::set<Date> none;
+        return overlay_ ? overlay_->removedHolidays : none;
+    }
+
+    inline bool Calendar::compiled() const {
+        return static_cast<bool>(index_);
+    }
+
+    inline const ext::shared_ptr<const BusinessDayIndex>&
+    Calendar::index() const {
+        return index_;
     }
 
     inline bool Calendar::isBusinessDay(const Date& d) const {
+        if (index_ && index_->covers(d))
+            return index_->isBusinessDay(d);
+
         QL_REQUIRE(impl_, "no implementation provided");
 
 #ifdef QL_HIGH_RESOLUTION_DATE
@@ -220,10 +312,14 @@ namespace QuantLib {
         const Date& _d = d;
 #endif
 
-        if (impl_->addedHolidays.find(_d) != impl_->addedHolidays.end())
-            return false;
-        if (impl_->removedHolidays.find(_d) != impl_->removedHolidays.end())
-            return true;
+        if (overlay_) {
+            if (overlay_->addedHolidays.find(_d) !=
+                overlay_->addedHolidays.end())
+                return false;
+            if (overlay_->removedHolidays.find(_d) !=
+                overlay_->removedHolidays.end())
+                return true;
+        }
 
         return impl_->isBusinessDay(_d);
     }
@@ -245,6 +341,26 @@ namespace QuantLib {
         return impl_->isWeekend(w);
     }
 
+    inline Natural Calendar::weekendMask() const {
+        QL_REQUIRE(impl_, "no implementation provided");
+        return impl_->weekendMask();
+    }
+
+    inline Calendar::Impl::Impl(Natural weekendMask)
+    : weekendMask_(weekendMask) {}
+
+    inline bool Calendar::Impl::isWeekend(Weekday w) const {
+        return ((weekendMask_ >> (w - 1)) & 1) != 0;
+    }
+
+    inline Natural Calendar::Impl::weekendMask() const {
+        return weekendMask_;
+    }
+
+    inline Natural Calendar::Impl::weekendOf(Weekday w1, Weekday w2) {
+        return (1U << (w1 - 1)) | (1U << (w2 - 1));
+    }
+
     inline bool operator==(const Calendar& c1, const Calendar& c2) {
         return (c1.empty() && c2.empty())
             || (!c1.empty() && !c2.empty() && c1.name() == c2.name());
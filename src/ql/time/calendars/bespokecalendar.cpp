@@ -23,22 +23,22 @@
 namespace QuantLib {
 
     BespokeCalendar::Impl::Impl(const std::string& name)
-    : name_(name) {}
+    : Calendar::Impl(0), name_(name) {}
 
     std::string BespokeCalendar::Impl::name() const {
         return name_;
     }
 
-    bool BespokeCalendar::Impl::isWeekend(Weekday w) const {
-        return (weekend_.find(w) != weekend_.end());
-    }
-
     bool BespokeCalendar::Impl::isBusinessDay(const Date& date) const {
         return !isWeekend(date.weekday());
     }
 
     void BespokeCalendar::Impl::addWeekend(Weekday w) {
-        weekend_.insert(w);
+        // compiled calendars sharing this implementation would
+        // silently keep the old weekend
+        QL_REQUIRE(!hasRuleIndex(),
+                   "cannot change the weekend of a compiled calendar");
+        weekendMask_ |= 1U << (w - 1);
     }
 
 
@@ -35,6 +35,9 @@ namespace QuantLib {
         the original one; adding a new holiday or weekday will affect
         all linked instances.
 
+        \warning weekdays can no longer be added once any of the
+                 linked instances was compiled.
+
         \ingroup calendars
     */
     class BespokeCalendar : public Calendar {
@@ -43,11 +46,9 @@ namespace QuantLib {
           public:
             explicit Impl(const std::string& name = "");
             std::string name() const;
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
             void addWeekend(Weekday);
           private:
-            std::set<Weekday> weekend_;
             std::string name_;
         };
         ext::shared_ptr<BespokeCalendar::Impl> bespokeImpl_;
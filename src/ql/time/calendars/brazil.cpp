@@ -43,11 +43,12 @@ namespace QuantLib {
     }
 
     bool Brazil::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        Day dd = date.dayOfYear();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
+        Day dd = fields.dayOfYear;
         Day em = easterMonday(y);
 
         if (isWeekend(w)
@@ -79,11 +80,12 @@ namespace QuantLib {
     }
 
     bool Brazil::ExchangeImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        Day dd = date.dayOfYear();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
+        Day dd = fields.dayOfYear;
         Day em = easterMonday(y);
 
         if (isWeekend(w)
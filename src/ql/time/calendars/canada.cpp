@@ -41,10 +41,11 @@ namespace QuantLib {
     }
 
     bool Canada::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth, dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
         Day em = easterMonday(y);
         if (isWeekend(w)
             // New Year's Day (possibly moved to Monday)
@@ -79,10 +80,11 @@ namespace QuantLib {
     }
 
     bool Canada::TsxImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth, dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
         Day em = easterMonday(y);
         if (isWeekend(w)
             // New Year's Day (possibly moved to Monday)
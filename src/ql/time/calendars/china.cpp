@@ -19,6 +19,7 @@
 */
 
 #include <ql/time/calendars/china.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 #include <set>
 
@@ -27,7 +28,7 @@ namespace QuantLib {
     China::China(Market m) {
         // all calendar instances share the same implementation instance
         static ext::shared_ptr<Calendar::Impl> sseImpl(new China::SseImpl);
-        static ext::shared_ptr<Calendar::Impl> IBImpl(new China::IbImpl);
+        static ext::shared_ptr<Calendar::Impl> IBImpl(new China::IbImpl(sseImpl));
         switch (m) {
           case SSE:
             impl_ = sseImpl;
@@ -40,133 +41,186 @@ namespace QuantLib {
         }
     }
 
-    bool China::SseImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
-
     bool China::SseImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        static const Date special_holidays[] = {
+            // New Year's Day
+            Date(3, Jan, 2005),
+            Date(2, Jan, 2006), Date(3, Jan, 2006),
+            Date(1, Jan, 2007), Date(2, Jan, 2007), Date(3, Jan, 2007),
+            Date(31, Dec, 2007),
+            Date(2, Jan, 2009),
+            Date(3, Jan, 2011),
+            Date(2, Jan, 2012), Date(3, Jan, 2012),
+            Date(1, Jan, 2013), Date(2, Jan, 2013), Date(3, Jan, 2013),
+            Date(1, Jan, 2014),
+            Date(1, Jan, 2015), Date(2, Jan, 2015), Date(3, Jan, 2015),
+            Date(2, Jan, 2017),
+            Date(1, Jan, 2018),
+            Date(31, Dec, 2018),
+            Date(1, Jan, 2019),
+            // Chinese New Year
+            Date(19, Jan, 2004), Date(20, Jan, 2004), Date(21, Jan, 2004),
+            Date(22, Jan, 2004), Date(23, Jan, 2004), Date(24, Jan, 2004),
+            Date(25, Jan, 2004), Date(26, Jan, 2004), Date(27, Jan, 2004),
+            Date(28, Jan, 2004),
+            Date(7, Feb, 2005), Date(8, Feb, 2005), Date(9, Feb, 2005),
+            Date(10, Feb, 2005), Date(11, Feb, 2005), Date(12, Feb, 2005),
+            Date(13, Feb, 2005), Date(14, Feb, 2005), Date(15, Feb, 2005),
+            Date(26, Jan, 2006), Date(27, Jan, 2006), Date(28, Jan, 2006),
+            Date(29, Jan, 2006), Date(30, Jan, 2006), Date(31, Jan, 2006),
+            Date(1, Feb, 2006), Date(2, Feb, 2006), Date(3, Feb, 2006),
+            Date(17, Feb, 2007), Date(18, Feb, 2007), Date(19, Feb, 2007),
+            Date(20, Feb, 2007), Date(21, Feb, 2007), Date(22, Feb, 2007),
+            Date(23, Feb, 2007), Date(24, Feb, 2007), Date(25, Feb, 2007),
+            Date(6, Feb, 2008), Date(7, Feb, 2008), Date(8, Feb, 2008),
+            Date(9, Feb, 2008), Date(10, Feb, 2008), Date(11, Feb, 2008),
+            Date(12, Feb, 2008),
+            Date(26, Jan, 2009), Date(27, Jan, 2009), Date(28, Jan, 2009),
+            Date(29, Jan, 2009), Date(30, Jan, 2009),
+            Date(15, Feb, 2010), Date(16, Feb, 2010), Date(17, Feb, 2010),
+            Date(18, Feb, 2010), Date(19, Feb, 2010),
+            Date(2, Feb, 2011), Date(3, Feb, 2011), Date(4, Feb, 2011),
+            Date(5, Feb, 2011), Date(6, Feb, 2011), Date(7, Feb, 2011),
+            Date(8, Feb, 2011),
+            Date(23, Jan, 2012), Date(24, Jan, 2012), Date(25, Jan, 2012),
+            Date(26, Jan, 2012), Date(27, Jan, 2012), Date(28, Jan, 2012),
+            Date(11, Feb, 2013), Date(12, Feb, 2013), Date(13, Feb, 2013),
+            Date(14, Feb, 2013), Date(15, Feb, 2013),
+            Date(31, Jan, 2014),
+            Date(1, Feb, 2014), Date(2, Feb, 2014), Date(3, Feb, 2014),
+            Date(4, Feb, 2014), Date(5, Feb, 2014), Date(6, Feb, 2014),
+            Date(18, Feb, 2015), Date(19, Feb, 2015), Date(20, Feb, 2015),
+            Date(21, Feb, 2015), Date(22, Feb, 2015), Date(23, Feb, 2015),
+            Date(24, Feb, 2015),
+            Date(8, Feb, 2016), Date(9, Feb, 2016), Date(10, Feb, 2016),
+            Date(11, Feb, 2016), Date(12, Feb, 2016),
+            Date(27, Jan, 2017), Date(28, Jan, 2017), Date(29, Jan, 2017),
+            Date(30, Jan, 2017), Date(31, Jan, 2017), Date(1, Feb, 2017),
+            Date(2, Feb, 2017),
+            Date(15, Feb, 2018), Date(16, Feb, 2018), Date(17, Feb, 2018),
+            Date(18, Feb, 2018), Date(19, Feb, 2018), Date(20, Feb, 2018),
+            Date(21, Feb, 2018),
+            Date(4, Feb, 2019), Date(5, Feb, 2019), Date(6, Feb, 2019),
+            Date(7, Feb, 2019), Date(8, Feb, 2019),
+            // Ching Ming Festival
+            Date(6, Apr, 2009),
+            Date(5, Apr, 2010),
+            Date(3, Apr, 2011), Date(4, Apr, 2011), Date(5, Apr, 2011),
+            Date(2, Apr, 2012), Date(3, Apr, 2012), Date(4, Apr, 2012),
+            Date(4, Apr, 2013), Date(5, Apr, 2013),
+            Date(7, Apr, 2014),
+            Date(5, Apr, 2015), Date(6, Apr, 2015),
+            Date(4, Apr, 2016),
+            Date(3, Apr, 2017), Date(4, Apr, 2017),
+            Date(5, Apr, 2018), Date(6, Apr, 2018),
+            Date(5, Apr, 2019),
+            // Labor Day
+            Date(1, May, 2008), Date(2, May, 2008),
+            Date(1, May, 2009),
+            Date(3, May, 2010),
+            Date(2, May, 2011),
+            Date(30, Apr, 2012), Date(1, May, 2012),
+            Date(29, Apr, 2013), Date(30, Apr, 2013), Date(1, May, 2013),
+            Date(1, May, 2014), Date(2, May, 2014), Date(3, May, 2014),
+            Date(1, May, 2015),
+            Date(1, May, 2016), Date(2, May, 2016),
+            Date(1, May, 2017),
+            Date(30, Apr, 2018), Date(1, May, 2018),
+            Date(1, May, 2019), Date(2, May, 2019), Date(3, May, 2019),
+            // Tuen Ng Festival
+            Date(28, May, 2009), Date(29, May, 2009),
+            Date(14, Jun, 2010), Date(15, Jun, 2010), Date(16, Jun, 2010),
+            Date(4, Jun, 2011), Date(5, Jun, 2011), Date(6, Jun, 2011),
+            Date(22, Jun, 2012), Date(23, Jun, 2012), Date(24, Jun, 2012),
+            Date(10, Jun, 2013), Date(11, Jun, 2013), Date(12, Jun, 2013),
+            Date(2, Jun, 2014),
+            Date(22, Jun, 2015),
+            Date(9, Jun, 2016), Date(10, Jun, 2016),
+            Date(29, May, 2017), Date(30, May, 2017),
+            Date(18, Jun, 2018),
+            Date(7, Jun, 2019),
+            // Mid-Autumn Festival
+            Date(22, Sep, 2010), Date(23, Sep, 2010), Date(24, Sep, 2010),
+            Date(10, Sep, 2011), Date(11, Sep, 2011), Date(12, Sep, 2011),
+            Date(30, Sep, 2012),
+            Date(19, Sep, 2013), Date(20, Sep, 2013),
+            Date(8, Sep, 2014),
+            Date(27, Sep, 2015),
+            Date(15, Sep, 2016), Date(16, Sep, 2016),
+            Date(24, Sep, 2018),
+            Date(13, Sep, 2019),
+            // National Day
+            Date(29, Sep, 2008), Date(30, Sep, 2008), Date(1, Oct, 2008),
+            Date(2, Oct, 2008), Date(3, Oct, 2008),
+            Date(1, Oct, 2009), Date(2, Oct, 2009), Date(3, Oct, 2009),
+            Date(4, Oct, 2009), Date(5, Oct, 2009), Date(6, Oct, 2009),
+            Date(7, Oct, 2009), Date(8, Oct, 2009),
+            Date(1, Oct, 2010), Date(2, Oct, 2010), Date(3, Oct, 2010),
+            Date(4, Oct, 2010), Date(5, Oct, 2010), Date(6, Oct, 2010),
+            Date(7, Oct, 2010),
+            Date(1, Oct, 2011), Date(2, Oct, 2011), Date(3, Oct, 2011),
+            Date(4, Oct, 2011), Date(5, Oct, 2011), Date(6, Oct, 2011),
+            Date(7, Oct, 2011),
+            Date(1, Oct, 2012), Date(2, Oct, 2012), Date(3, Oct, 2012),
+            Date(4, Oct, 2012), Date(5, Oct, 2012), Date(6, Oct, 2012),
+            Date(7, Oct, 2012),
+            Date(1, Oct, 2013), Date(2, Oct, 2013), Date(3, Oct, 2013),
+            Date(4, Oct, 2013), Date(5, Oct, 2013), Date(6, Oct, 2013),
+            Date(7, Oct, 2013),
+            Date(1, Oct, 2014), Date(2, Oct, 2014), Date(3, Oct, 2014),
+            Date(4, Oct, 2014), Date(5, Oct, 2014), Date(6, Oct, 2014),
+            Date(7, Oct, 2014),
+            Date(1, Oct, 2015), Date(2, Oct, 2015), Date(3, Oct, 2015),
+            Date(4, Oct, 2015), Date(5, Oct, 2015), Date(6, Oct, 2015),
+            Date(7, Oct, 2015),
+            Date(3, Oct, 2016), Date(4, Oct, 2016), Date(5, Oct, 2016),
+            Date(6, Oct, 2016), Date(7, Oct, 2016),
+            Date(2, Oct, 2017), Date(3, Oct, 2017), Date(4, Oct, 2017),
+            Date(5, Oct, 2017), Date(6, Oct, 2017),
+            Date(1, Oct, 2018), Date(2, Oct, 2018), Date(3, Oct, 2018),
+            Date(4, Oct, 2018), Date(5, Oct, 2018),
+            Date(30, Sep, 2019), Date(1, Oct, 2019), Date(2, Oct, 2019),
+            Date(3, Oct, 2019), Date(4, Oct, 2019),
+            // 70th anniversary of the victory of anti-Japaneses war
+            Date(3, Sep, 2015), Date(4, Sep, 2015)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
 
         if (isWeekend(w)
             // New Year's Day
             || (d == 1 && m == January)
-            || (y == 2005 && d == 3 && m == January)
-            || (y == 2006 && (d == 2 || d == 3) && m == January)
-            || (y == 2007 && d <= 3 && m == January)
-            || (y == 2007 && d == 31 && m == December)
-            || (y == 2009 && d == 2 && m == January)
-            || (y == 2011 && d == 3 && m == January)
-            || (y == 2012 && (d == 2 || d == 3) && m == January)
-            || (y == 2013 && d <= 3 && m == January)
-            || (y == 2014 && d == 1 && m == January)
-            || (y == 2015 && d <= 3 && m == January)
-            || (y == 2017 && d == 2 && m == January)
-            || (y == 2018 && d == 1 && m == January)
-            || (y == 2018 && d == 31 && m == December)
-            || (y == 2019 && d == 1 && m == January)
-            // Chinese New Year
-            || (y == 2004 && d >= 19 && d <= 28 && m == January)
-            || (y == 2005 && d >=  7 && d <= 15 && m == February)
-            || (y == 2006 && ((d >= 26 && m == January) ||
-                              (d <= 3 && m == February)))
-            || (y == 2007 && d >= 17 && d <= 25 && m == February)
-            || (y == 2008 && d >= 6 && d <= 12 && m == February)
-            || (y == 2009 && d >= 26 && d <= 30 && m == January)
-            || (y == 2010 && d >= 15 && d <= 19 && m == February)
-            || (y == 2011 && d >= 2 && d <= 8 && m == February)
-            || (y == 2012 && d >= 23 && d <= 28 && m == January)
-            || (y == 2013 && d >= 11 && d <= 15 && m == February)
-            || (y == 2014 && d >= 31 && m == January)
-            || (y == 2014 && d <= 6 && m == February)
-            || (y == 2015 && d >= 18 && d <= 24 && m == February)
-            || (y == 2016 && d >= 8 && d <= 12 && m == February)
-            || (y == 2017 && ((d >= 27 && m == January) ||
-                              (d <= 2 && m == February)))
-            || (y == 2018 && (d >= 15 && d <= 21 && m == February))
-            || (y == 2019 && d >= 4 && d <= 8 && m == February)
             // Ching Ming Festival
             || (y <= 2008 && d == 4 && m == April)
-            || (y == 2009 && d == 6 && m == April)
-            || (y == 2010 && d == 5 && m == April)
-            || (y == 2011 && d >=3 && d <= 5 && m == April)
-            || (y == 2012 && d >= 2 && d <= 4 && m == April)
-            || (y == 2013 && d >= 4 && d <= 5 && m == April)
-            || (y == 2014 && d == 7 && m == April)
-            || (y == 2015 && d >= 5 && d <= 6 && m == April)
-            || (y == 2016 && d == 4 && m == April)
-            || (y == 2017 && d >= 3 && d <= 4 && m == April)
-            || (y == 2018 && d >= 5 && d <= 6 && m == April)
-            || (y == 2019 && d == 5 && m == April)
             // Labor Day
             || (y <= 2007 && d >= 1 && d <= 7 && m == May)
-            || (y == 2008 && d >= 1 && d <= 2 && m == May)
-            || (y == 2009 && d == 1 && m == May)
-            || (y == 2010 && d == 3 && m == May)
-            || (y == 2011 && d == 2 && m == May)
-            || (y == 2012 && ((d == 30 && m == April) ||
-                              (d == 1 && m == May)))
-            || (y == 2013 && ((d >= 29 && m == April) ||
-                              (d == 1 && m == May)))
-            || (y == 2014 && d >= 1 && d <=3 && m == May)
-            || (y == 2015 && d == 1 && m == May)
-            || (y == 2016 && d >= 1 && d <=2 && m == May)
-            || (y == 2017 && d == 1 && m == May)
-            || (y == 2018 && ((d == 30 && m == April) || (d == 1 && m == May)))
-            || (y == 2019 && d >= 1 && d <=3 && m == May)
             // Tuen Ng Festival
             || (y <= 2008 && d == 9 && m == June)
-            || (y == 2009 && (d == 28 || d == 29) && m == May)
-            || (y == 2010 && d >= 14 && d <= 16 && m == June)
-            || (y == 2011 && d >= 4 && d <= 6 && m == June)
-            || (y == 2012 && d >= 22 && d <= 24 && m == June)
-            || (y == 2013 && d >= 10 && d <= 12 && m == June)
-            || (y == 2014 && d == 2 && m == June)
-            || (y == 2015 && d == 22 && m == June)
-            || (y == 2016 && d >= 9 && d <= 10 && m == June)
-            || (y == 2017 && d >= 29 && d <= 30 && m == May)
-            || (y == 2018 && d == 18 && m == June)
-            || (y == 2019 && d == 7 && m == June)
             // Mid-Autumn Festival
             || (y <= 2008 && d == 15 && m == September)
-            || (y == 2010 && d >= 22 && d <= 24 && m == September)
-            || (y == 2011 && d >= 10 && d <= 12 && m == September)
-            || (y == 2012 && d == 30 && m == September)
-            || (y == 2013 && d >= 19 && d <= 20 && m == September)
-            || (y == 2014 && d == 8 && m == September)
-            || (y == 2015 && d == 27 && m == September)
-            || (y == 2016 && d >= 15 && d <= 16 && m == September)
-            || (y == 2018 && d == 24 && m == September)
-            || (y == 2019 && d == 13 && m == September)
             // National Day
-            || (y <= 2007 && d >= 1 && d <= 7 && m == October) 
-            || (y == 2008 && ((d >= 29 && m == September) ||
-                              (d <= 3 && m == October)))
-            || (y == 2009 && d >= 1 && d <= 8 && m == October)
-            || (y == 2010 && d >= 1 && d <= 7 && m == October)
-            || (y == 2011 && d >= 1 && d <= 7 && m == October)
-            || (y == 2012 && d >= 1 && d <= 7 && m == October)
-            || (y == 2013 && d >= 1 && d <= 7 && m == October)
-            || (y == 2014 && d >= 1 && d <= 7 && m == October)
-            || (y == 2015 && d >= 1 && d <= 7 && m == October)
-            || (y == 2016 && d >= 3 && d <= 7 && m == October)
-            || (y == 2017 && d >= 2 && d <= 6 && m == October)
-            || (y == 2018 && d >= 1 && d <= 5 && m == October)
-            || (y == 2019 && ((d == 30 && m == September) || (d >= 1 && d <= 4 && m == October)))
-            // 70th anniversary of the victory of anti-Japaneses war
-            || (y == 2015 && d >= 3 && d <= 4 && m == September)
-            )
+            || (y <= 2007 && d >= 1 && d <= 7 && m == October)
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
             return false;
         return true;
     }
 
-    bool China::IbImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
+    bool China::IbImpl::isBusinessDay(const Date& date) const {
+        // the SSE rules cover every date, and so does the index
+        return ruleIndex()->isBusinessDay(date);
     }
 
-    bool China::IbImpl::isBusinessDay(const Date& date) const {
+    ext::shared_ptr<const BusinessDayIndex>
+    China::IbImpl::buildRuleIndex() const {
         static const Date working_weekends[] = {
             // 2005
             Date(5, February, 2005),
@@ -283,12 +337,13 @@ namespace QuantLib {
         };
         static const Size n =
             sizeof(working_weekends)/sizeof(working_weekends[0]);
-        static const std::set<Date> workingWeekends(working_weekends+0,
-                                                    working_weekends+n);
 
-        // If it is already a SSE business day, it must be a IB business day
-        return sseImpl->isBusinessDay(date) ||
-            (workingWeekends.find(date) != workingWeekends.end());
+        // SSE business days are IB business days, and so are the
+        // working weekends
+        return ext::make_shared<BusinessDayIndex>(
+            *sseImpl->ruleIndex(),
+            std::set<Date>(),
+            std::set<Date>(working_weekends+0, working_weekends+n));
     }
 
 }
@@ -59,19 +59,20 @@ namespace QuantLib {
       private:
         class SseImpl : public Calendar::Impl {
           public:
+            SseImpl() : Calendar::Impl(weekendOf(Saturday, Sunday)) {}
             std::string name() const { return "Shanghai stock exchange"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
 
         class IbImpl : public Calendar::Impl {
           public:
-            IbImpl() {
-                sseImpl = ext::shared_ptr<Calendar::Impl>(new China::SseImpl);
-            }
+            explicit IbImpl(const ext::shared_ptr<Calendar::Impl>& sse)
+            : Calendar::Impl(weekendOf(Saturday, Sunday)), sseImpl(sse) {}
             std::string name() const { return "China inter bank market";}
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
+          protected:
+            // the SSE rule index with the working weekends added
+            ext::shared_ptr<const BusinessDayIndex> buildRuleIndex() const;
           private:
             ext::shared_ptr<Calendar::Impl> sseImpl;
         };
@@ -18,6 +18,7 @@
 */
 
 #include <ql/time/calendars/germany.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -59,149 +60,140 @@ namespace QuantLib {
 
 
     bool Germany::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1 && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Easter Monday
-            || (dd == em)
+            HolidayRule::easter(0),
             // Ascension Thursday
-            || (dd == em+38)
+            HolidayRule::easter(38),
             // Whit Monday
-            || (dd == em+49)
+            HolidayRule::easter(49),
             // Corpus Christi
-            || (dd == em+59)
+            HolidayRule::easter(59),
             // Labour Day
-            || (d == 1 && m == May)
+            HolidayRule::fixed(May, 1),
             // National Day
-            || (d == 3 && m == October)
+            HolidayRule::fixed(October, 3),
             // Christmas Eve
-            || (d == 24 && m == December)
+            HolidayRule::fixed(December, 24),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Boxing Day
-            || (d == 26 && m == December)
+            HolidayRule::fixed(December, 26),
             // New Year's Eve
-            || (d == 31 && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
     bool Germany::FrankfurtStockExchangeImpl::isBusinessDay(
       const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1 && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Easter Monday
-            || (dd == em)
+            HolidayRule::easter(0),
             // Labour Day
-            || (d == 1 && m == May)
+            HolidayRule::fixed(May, 1),
             // Christmas' Eve
-            || (d == 24 && m == December)
+            HolidayRule::fixed(December, 24),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Christmas Day
-            || (d == 26 && m == December)
+            HolidayRule::fixed(December, 26),
             // New Year's Eve
-            || (d == 31 && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
     bool Germany::XetraImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1 && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Easter Monday
-            || (dd == em)
+            HolidayRule::easter(0),
             // Labour Day
-            || (d == 1 && m == May)
+            HolidayRule::fixed(May, 1),
             // Christmas' Eve
-            || (d == 24 && m == December)
+            HolidayRule::fixed(December, 24),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Christmas Day
-            || (d == 26 && m == December)
+            HolidayRule::fixed(December, 26),
             // New Year's Eve
-            || (d == 31 && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
     bool Germany::EurexImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1 && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Easter Monday
-            || (dd == em)
+            HolidayRule::easter(0),
             // Labour Day
-            || (d == 1 && m == May)
+            HolidayRule::fixed(May, 1),
             // Christmas' Eve
-            || (d == 24 && m == December)
+            HolidayRule::fixed(December, 24),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Christmas Day
-            || (d == 26 && m == December)
+            HolidayRule::fixed(December, 26),
             // New Year's Eve
-            || (d == 31 && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
     
     bool Germany::EuwaxImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if ((w == Saturday || w == Sunday)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1 && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Easter Monday
-            || (dd == em)
+            HolidayRule::easter(0),
             // Labour Day
-            || (d == 1 && m == May)
+            HolidayRule::fixed(May, 1),
             // Whit Monday
-            || (dd == em+49)
+            HolidayRule::easter(49),
             // Christmas' Eve
-            || (d == 24 && m == December)
+            HolidayRule::fixed(December, 24),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Christmas Day
-            || (d == 26 && m == December)
+            HolidayRule::fixed(December, 26),
             // New Year's Eve
-            || (d == 31 && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        Weekday w = date.weekday();
+        return !(w == Saturday || w == Sunday) && !holidays.isHoliday(date);
     }
 }
 
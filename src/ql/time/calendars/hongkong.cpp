@@ -19,6 +19,7 @@
 */
 
 #include <ql/time/calendars/hongkong.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -36,296 +37,254 @@ namespace QuantLib {
     }
 
     bool HongKong::HkexImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
+        static const Date special_holidays[] = {
+            // Lunar New Year
+            Date(22, Jan, 2004), Date(23, Jan, 2004), Date(24, Jan, 2004),
+            // Ching Ming Festival
+            Date(5, Apr, 2004),
+            // Buddha's birthday
+            Date(26, May, 2004),
+            // Tuen Ng festival
+            Date(22, Jun, 2004),
+            // Mid-autumn festival
+            Date(29, Sep, 2004),
+            // Chung Yeung
+            Date(22, Oct, 2004),
 
-        if (isWeekend(w)
-            // New Year's Day
-            || ((d == 1 || ((d == 2) && w == Monday))
-                && m == January)
-            // Good Friday
-            || (dd == em-3)
-            // Easter Monday
-            || (dd == em)
-            // Labor Day
-            || ((d == 1 || ((d == 2) && w == Monday)) && m == May)
-            // SAR Establishment Day
-            || ((d == 1 || ((d == 2) && w == Monday)) && m == July)
-            // National Day
-            || ((d == 1 || ((d == 2) && w == Monday))
-                && m == October)
-            // Christmas Day
-            || (d == 25 && m == December)
-            // Boxing Day
-            || (d == 26 && m == December)
-            )
-            return false;
+            // Lunar New Year
+            Date(9, Feb, 2005), Date(10, Feb, 2005), Date(11, Feb, 2005),
+            // Ching Ming Festival
+            Date(5, Apr, 2005),
+            // Buddha's birthday
+            Date(16, May, 2005),
+            // Tuen Ng festival
+            Date(11, Jun, 2005),
+            // Mid-autumn festival
+            Date(19, Sep, 2005),
+            // Chung Yeung festival
+            Date(11, Oct, 2005),
 
-        if (y == 2004) {
-            if (// Lunar New Year
-                ((d==22 || d==23 || d==24) && m == January)
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 26 && m == May)
-                // Tuen Ng festival
-                || (d == 22 && m == June)
-                // Mid-autumn festival
-                || (d == 29 && m == September)
-                // Chung Yeung
-                || (d == 22 && m == October))
-                return false;
-        }
+            // Lunar New Year
+            Date(28, Jan, 2006), Date(29, Jan, 2006), Date(30, Jan, 2006),
+            Date(31, Jan, 2006),
+            // Ching Ming Festival
+            Date(5, Apr, 2006),
+            // Buddha's birthday
+            Date(5, May, 2006),
+            // Tuen Ng festival
+            Date(31, May, 2006),
+            // Mid-autumn festival
+            Date(7, Oct, 2006),
+            // Chung Yeung festival
+            Date(30, Oct, 2006),
 
-        if (y == 2005) {
-            if (// Lunar New Year
-                ((d==9 || d==10 || d==11) && m == February)
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 16 && m == May)
-                // Tuen Ng festival
-                || (d == 11 && m == June)
-                // Mid-autumn festival
-                || (d == 19 && m == September)
-                // Chung Yeung festival
-                || (d == 11 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(17, Feb, 2007), Date(18, Feb, 2007), Date(19, Feb, 2007),
+            Date(20, Feb, 2007),
+            // Ching Ming Festival
+            Date(5, Apr, 2007),
+            // Buddha's birthday
+            Date(24, May, 2007),
+            // Tuen Ng festival
+            Date(19, Jun, 2007),
+            // Mid-autumn festival
+            Date(26, Sep, 2007),
+            // Chung Yeung festival
+            Date(19, Oct, 2007),
 
-        if (y == 2006) {
-            if (// Lunar New Year
-                ((d >= 28 && d <= 31) && m == January)
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 5 && m == May)
-                // Tuen Ng festival
-                || (d == 31 && m == May)
-                // Mid-autumn festival
-                || (d == 7 && m == October)
-                // Chung Yeung festival
-                || (d == 30 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(7, Feb, 2008), Date(8, Feb, 2008), Date(9, Feb, 2008),
+            // Ching Ming Festival
+            Date(4, Apr, 2008),
+            // Buddha's birthday
+            Date(12, May, 2008),
+            // Tuen Ng festival
+            Date(9, Jun, 2008),
+            // Mid-autumn festival
+            Date(15, Sep, 2008),
+            // Chung Yeung festival
+            Date(7, Oct, 2008),
 
-        if (y == 2007) {
-            if (// Lunar New Year
-                ((d >= 17 && d <= 20) && m == February)
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 24 && m == May)
-                // Tuen Ng festival
-                || (d == 19 && m == June)
-                // Mid-autumn festival
-                || (d == 26 && m == September)
-                // Chung Yeung festival
-                || (d == 19 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(26, Jan, 2009), Date(27, Jan, 2009), Date(28, Jan, 2009),
+            // Ching Ming Festival
+            Date(4, Apr, 2009),
+            // Buddha's birthday
+            Date(2, May, 2009),
+            // Tuen Ng festival
+            Date(28, May, 2009),
+            // Mid-autumn festival
+            Date(3, Oct, 2009),
+            // Chung Yeung festival
+            Date(26, Oct, 2009),
 
-        if (y == 2008) {
-            if (// Lunar New Year
-                ((d >= 7 && d <= 9) && m == February)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Buddha's birthday
-                || (d == 12 && m == May)
-                // Tuen Ng festival
-                || (d == 9 && m == June)
-                // Mid-autumn festival
-                || (d == 15 && m == September)
-                // Chung Yeung festival
-                || (d == 7 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(15, Feb, 2010), Date(16, Feb, 2010),
+            // Ching Ming Festival
+            Date(6, Apr, 2010),
+            // Buddha's birthday
+            Date(21, May, 2010),
+            // Tuen Ng festival
+            Date(16, Jun, 2010),
+            // Mid-autumn festival
+            Date(23, Sep, 2010),
 
-        if (y == 2009) {
-            if (// Lunar New Year
-                ((d >= 26 && d <= 28) && m == January)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Buddha's birthday
-                || (d == 2 && m == May)
-                // Tuen Ng festival
-                || (d == 28 && m == May)
-                // Mid-autumn festival
-                || (d == 3 && m == October)
-                // Chung Yeung festival
-                || (d == 26 && m == October))
-            return false;
-        }
-
-        if (y == 2010) {
-            if (// Lunar New Year
-                ((d == 15 || d == 16) && m == February)
-                // Ching Ming Festival
-                || (d == 6 && m == April)
-                // Buddha's birthday
-                || (d == 21 && m == May)
-                // Tuen Ng festival
-                || (d == 16 && m == June)
-                // Mid-autumn festival
-                || (d == 23 && m == September))
-            return false;
-        }
+            // Lunar New Year
+            Date(3, Feb, 2011), Date(4, Feb, 2011),
+            // Ching Ming Festival
+            Date(5, Apr, 2011),
+            // Buddha's birthday
+            Date(10, May, 2011),
+            // Tuen Ng festival
+            Date(6, Jun, 2011),
+            // Mid-autumn festival
+            Date(13, Sep, 2011),
+            // Chung Yeung festival
+            Date(5, Oct, 2011),
+            // Second day after Christmas
+            Date(27, Dec, 2011),
 
-        if (y == 2011) {
-            if (// Lunar New Year
-                ((d == 3 || d == 4) && m == February)
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 10 && m == May)
-                // Tuen Ng festival
-                || (d == 6 && m == June)
-                // Mid-autumn festival
-                || (d == 13 && m == September)
-                // Chung Yeung festival
-                || (d == 5 && m == October)
-                // Second day after Christmas
-                || (d == 27 && m == December))
-            return false;
-        }
+            // Lunar New Year
+            Date(23, Jan, 2012), Date(24, Jan, 2012), Date(25, Jan, 2012),
+            // Ching Ming Festival
+            Date(4, Apr, 2012),
+            // Buddha's birthday
+            Date(10, May, 2012),
+            // Mid-autumn festival
+            Date(1, Oct, 2012),
+            // Chung Yeung festival
+            Date(23, Oct, 2012),
 
-        if (y == 2012) {
-            if (// Lunar New Year
-                (d >= 23 && d <= 25 && m == January)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Buddha's birthday
-                || (d == 10 && m == May)
-                // Mid-autumn festival
-                || (d == 1 && m == October)
-                // Chung Yeung festival
-                || (d == 23 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(11, Feb, 2013), Date(12, Feb, 2013), Date(13, Feb, 2013),
+            // Ching Ming Festival
+            Date(4, Apr, 2013),
+            // Buddha's birthday
+            Date(17, May, 2013),
+            // Tuen Ng festival
+            Date(12, Jun, 2013),
+            // Mid-autumn festival
+            Date(20, Sep, 2013),
+            // Chung Yeung festival
+            Date(14, Oct, 2013),
 
-        if (y == 2013) {
-            if (// Lunar New Year
-                (d >= 11 && d <= 13 && m == February)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Buddha's birthday
-                || (d == 17 && m == May)
-                // Tuen Ng festival
-                || (d == 12 && m == June)
-                // Mid-autumn festival
-                || (d == 20 && m == September)
-                // Chung Yeung festival
-                || (d == 14 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(31, Jan, 2014), Date(1, Feb, 2014), Date(2, Feb, 2014),
+            Date(3, Feb, 2014),
+            // Buddha's birthday
+            Date(6, May, 2014),
+            // Tuen Ng festival
+            Date(2, Jun, 2014),
+            // Mid-autumn festival
+            Date(9, Sep, 2014),
+            // Chung Yeung festival
+            Date(2, Oct, 2014),
 
-        if (y == 2014) {
-            if (// Lunar New Year
-                ((d == 31 && m == January) || (d <= 3 && m == February))
-                // Buddha's birthday
-                || (d == 6 && m == May)
-                // Tuen Ng festival
-                || (d == 2 && m == June)
-                // Mid-autumn festival
-                || (d == 9 && m == September)
-                // Chung Yeung festival
-                || (d == 2 && m == October))
-            return false;
-        }
+            // Lunar New Year
+            Date(19, Feb, 2015), Date(20, Feb, 2015),
+            // The day following Easter Monday
+            Date(7, Apr, 2015),
+            // Buddha's birthday
+            Date(25, May, 2015),
+            // Tuen Ng festival
+            Date(20, Jun, 2015),
+            // Mid-autumn festival
+            Date(28, Sep, 2015),
+            // Chung Yeung festival
+            Date(21, Oct, 2015),
 
-        if (y == 2015) {
-            if (// Lunar New Year
-                ((d == 19 && m == February) || (d == 20 && m == February))
-                // The day following Easter Monday
-                || (d == 7 && m == April)
-                // Buddha's birthday
-                || (d == 25 && m == May)
-                // Tuen Ng festival
-                || (d == 20 && m == June)
-                // Mid-autumn festival
-                || (d == 28 && m == September)
-                // Chung Yeung festival
-                || (d == 21 && m == October))
-                return false;
-        }
+            // Lunar New Year
+            Date(8, Feb, 2016), Date(9, Feb, 2016), Date(10, Feb, 2016),
+            // Ching Ming Festival
+            Date(4, Apr, 2016),
+            // Tuen Ng festival
+            Date(9, Jun, 2016),
+            // Mid-autumn festival
+            Date(16, Sep, 2016),
+            // Chung Yeung festival
+            Date(10, Oct, 2016),
+            // Second day after Christmas
+            Date(27, Dec, 2016),
 
-        if (y == 2016) {
-            if (// Lunar New Year
-                ((d >= 8 && d <= 10) && m == February)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Tuen Ng festival
-                || (d == 9 && m == June)
-                // Mid-autumn festival
-                || (d == 16 && m == September)
-                // Chung Yeung festival
-                || (d == 10 && m == October)
-                // Second day after Christmas
-                || (d == 27 && m == December))
-                return false;
-        }
+            // Lunar New Year
+            Date(30, Jan, 2017), Date(31, Jan, 2017),
+            // Ching Ming Festival
+            Date(4, Apr, 2017),
+            // Buddha's birthday
+            Date(3, May, 2017),
+            // Tuen Ng festival
+            Date(30, May, 2017),
+            // Mid-autumn festival
+            Date(5, Oct, 2017),
 
-        if (y == 2017) {
-            if (// Lunar New Year
-                ((d == 30 || d == 31) && m == January)
-                // Ching Ming Festival
-                || (d == 4 && m == April)
-                // Buddha's birthday
-                || (d == 3 && m == May)
-                // Tuen Ng festival
-                || (d == 30 && m == May)
-                // Mid-autumn festival
-                || (d == 5 && m == October))
-                return false;
-        }
+            // Lunar New Year
+            Date(16, Feb, 2018), Date(19, Feb, 2018),
+            // Ching Ming Festival
+            Date(5, Apr, 2018),
+            // Buddha's birthday
+            Date(22, May, 2018),
+            // Tuen Ng festival
+            Date(18, Jun, 2018),
+            // Mid-autumn festival
+            Date(25, Sep, 2018),
+            // Chung Yeung festival
+            Date(17, Oct, 2018),
 
-        if (y == 2018) {
-            if (// Lunar New Year
-                ((d == 16 && m == February) || (d == 19 && m == February))
-                // Ching Ming Festival
-                || (d == 5 && m == April)
-                // Buddha's birthday
-                || (d == 22 && m == May)
-                // Tuen Ng festival
-                || (d == 18 && m == June)
-                // Mid-autumn festival
-                || (d == 25 && m == September)
-                // Chung Yeung festival
-                || (d == 17 && m == October))
-                return false;
-        }
+            // Lunar New Year
+            Date(5, Feb, 2019), Date(6, Feb, 2019), Date(7, Feb, 2019),
+            // Ching Ming Festival
+            Date(5, Apr, 2019),
+            // Tuen Ng festival
+            Date(7, Jun, 2019),
+            // Chung Yeung festival
+            Date(7, Oct, 2019),
 
-        if (y == 2019) {
-           if (// Lunar New Year
-               ((d >= 5 && d <= 7) && m == February)
-               // Ching Ming Festival
-               || (d == 5 && m == April)
-               // Tuen Ng festival
-               || (d == 7 && m == June)
-               // Chung Yeung festival
-               || (d == 7 && m == October))
-               return false;
-        }
+            // Lunar New Year
+            Date(27, Jan, 2020), Date(28, Jan, 2020),
+            // Ching Ming Festival
+            Date(4, Apr, 2020),
+            // Buddha's birthday
+            Date(30, Apr, 2020),
+            // Tuen Ng festival
+            Date(25, Jun, 2020),
+            // Mid-autumn festival
+            Date(2, Oct, 2020),
+            // Chung Yeung festival
+            Date(26, Oct, 2020)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
 
-        if (y == 2020) {
-           if (// Lunar New Year
-               ((d == 27 || d == 28) && m == January)
-               // Ching Ming Festival
-               || (d == 4 && m == April)
-               // Buddha's birthday
-               || (d == 30 && m == April)
-               // Tuen Ng festival
-               || (d == 25 && m == June)
-               // Mid-autumn festival
-               || (d == 2 && m == October)
-               // Chung Yeung festival
-               || (d == 26 && m == October))
-               return false;
-        }
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Day dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
+        Day em = easterMonday(y);
 
+        if (isWeekend(w)
+            // New Year's Day
+            || ((d == 1 || ((d == 2) && w == Monday)) && m == January)
+            // Good Friday
+            || (dd == em-3)
+            // Easter Monday
+            || (dd == em)
+            // Labor Day
+            || ((d == 1 || ((d == 2) && w == Monday)) && m == May)
+            // SAR Establishment Day
+            || ((d == 1 || ((d == 2) && w == Monday)) && m == July)
+            // National Day
+            || ((d == 1 || ((d == 2) && w == Monday)) && m == October)
+            // Christmas Day
+            || (d == 25 && m == December)
+            // Boxing Day
+            || (d == 26 && m == December)
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
+            return false;
         return true;
     }
 
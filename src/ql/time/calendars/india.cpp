@@ -18,6 +18,7 @@
 */
 
 #include <ql/time/calendars/india.hpp>
+#include <ql/time/holidayrule.hpp>
 
 namespace QuantLib {
 
@@ -28,11 +29,210 @@ namespace QuantLib {
     }
 
     bool India::NseImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        Day dd = date.dayOfYear();
+        static const Date special_holidays[] = {
+            // 2005: Moharram, Holi, Maharashtra Day, and Ramzan Id fall
+            // on Saturday or Sunday in 2005
+            // Bakri Id
+            Date(21, Jan, 2005),
+            // Ganesh Chaturthi
+            Date(7, Sep, 2005),
+            // Dasara
+            Date(12, Oct, 2005),
+            // Laxmi Puja
+            Date(1, Nov, 2005),
+            // Bhaubeej
+            Date(3, Nov, 2005),
+            // Guru Nanak Jayanti
+            Date(15, Nov, 2005),
+
+            // Bakri Id
+            Date(11, Jan, 2006),
+            // Moharram
+            Date(9, Feb, 2006),
+            // Holi
+            Date(15, Mar, 2006),
+            // Ram Navami
+            Date(6, Apr, 2006),
+            // Mahavir Jayanti
+            Date(11, Apr, 2006),
+            // Maharashtra Day
+            Date(1, May, 2006),
+            // Bhaubeej
+            Date(24, Oct, 2006),
+            // Ramzan Id
+            Date(25, Oct, 2006),
+
+            // Bakri Id
+            Date(1, Jan, 2007),
+            // Moharram
+            Date(30, Jan, 2007),
+            // Mahashivratri
+            Date(16, Feb, 2007),
+            // Ram Navami
+            Date(27, Mar, 2007),
+            // Maharashtra Day
+            Date(1, May, 2007),
+            // Buddha Pournima
+            Date(2, May, 2007),
+            // Laxmi Puja
+            Date(9, Nov, 2007),
+            // Bakri Id (again)
+            Date(21, Dec, 2007),
+
+            // Mahashivratri
+            Date(6, Mar, 2008),
+            // Id-E-Milad
+            Date(20, Mar, 2008),
+            // Mahavir Jayanti
+            Date(18, Apr, 2008),
+            // Maharashtra Day
+            Date(1, May, 2008),
+            // Buddha Pournima
+            Date(19, May, 2008),
+            // Ganesh Chaturthi
+            Date(3, Sep, 2008),
+            // Ramzan Id
+            Date(2, Oct, 2008),
+            // Dasara
+            Date(9, Oct, 2008),
+            // Laxmi Puja
+            Date(28, Oct, 2008),
+            // Bhau bhij
+            Date(30, Oct, 2008),
+            // Gurunanak Jayanti
+            Date(13, Nov, 2008),
+            // Bakri Id
+            Date(9, Dec, 2008),
+
+            // Moharram
+            Date(8, Jan, 2009),
+            // Mahashivratri
+            Date(23, Feb, 2009),
+            // Id-E-Milad
+            Date(10, Mar, 2009),
+            // Holi
+            Date(11, Mar, 2009),
+            // Ram Navmi
+            Date(3, Apr, 2009),
+            // Mahavir Jayanti
+            Date(7, Apr, 2009),
+            // Maharashtra Day
+            Date(1, May, 2009),
+            // Ramzan Id
+            Date(21, Sep, 2009),
+            // Dasara
+            Date(28, Sep, 2009),
+            // Bhau Bhij
+            Date(19, Oct, 2009),
+            // Gurunanak Jayanti
+            Date(2, Nov, 2009),
+            // Moharram (again)
+            Date(28, Dec, 2009),
+
+            // New Year's Day
+            Date(1, Jan, 2010),
+            // Mahashivratri
+            Date(12, Feb, 2010),
+            // Holi
+            Date(1, Mar, 2010),
+            // Ram Navmi
+            Date(24, Mar, 2010),
+            // Ramzan Id
+            Date(10, Sep, 2010),
+            // Laxmi Puja
+            Date(5, Nov, 2010),
+            // Bakri Id
+            Date(17, Nov, 2010),
+            // Moharram
+            Date(17, Dec, 2010),
+
+            // Mahashivratri
+            Date(2, Mar, 2011),
+            // Ram Navmi
+            Date(12, Apr, 2011),
+            // Ramzan Id
+            Date(31, Aug, 2011),
+            // Ganesh Chaturthi
+            Date(1, Sep, 2011),
+            // Dasara
+            Date(6, Oct, 2011),
+            // Laxmi Puja
+            Date(26, Oct, 2011),
+            // Diwali - Balipratipada
+            Date(27, Oct, 2011),
+            // Bakri Id
+            Date(7, Nov, 2011),
+            // Gurunanak Jayanti
+            Date(10, Nov, 2011),
+            // Moharram
+            Date(6, Dec, 2011),
+
+            // Mahashivratri
+            Date(20, Feb, 2012),
+            // Holi
+            Date(8, Mar, 2012),
+            // Mahavir Jayanti
+            Date(5, Apr, 2012),
+            // Ramzan Id
+            Date(20, Aug, 2012),
+            // Ganesh Chaturthi
+            Date(19, Sep, 2012),
+            // Dasara
+            Date(24, Oct, 2012),
+            // Diwali - Balipratipada
+            Date(14, Nov, 2012),
+            // Gurunanak Jayanti
+            Date(28, Nov, 2012),
+
+            // Holi
+            Date(27, Mar, 2013),
+            // Ram Navmi
+            Date(19, Apr, 2013),
+            // Mahavir Jayanti
+            Date(24, Apr, 2013),
+            // Ramzan Id
+            Date(9, Aug, 2013),
+            // Ganesh Chaturthi
+            Date(9, Sep, 2013),
+            // Bakri Id
+            Date(16, Oct, 2013),
+            // Diwali - Balipratipada
+            Date(4, Nov, 2013),
+            // Moharram
+            Date(14, Nov, 2013),
+
+            // Mahashivratri
+            Date(27, Feb, 2014),
+            // Holi
+            Date(17, Mar, 2014),
+            // Ram Navmi
+            Date(8, Apr, 2014),
+            // Ramzan Id
+            Date(29, Jul, 2014),
+            // Ganesh Chaturthi
+            Date(29, Aug, 2014),
+            // Dasera
+            Date(3, Oct, 2014),
+            // Bakri Id
+            Date(6, Oct, 2014),
+            // Diwali - Balipratipada
+            Date(24, Oct, 2014),
+            // Moharram
+            Date(4, Nov, 2014),
+            // Gurunank Jayanti
+            Date(6, Nov, 2014)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Day dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
         Day em = easterMonday(y);
 
         if (isWeekend(w)
@@ -50,241 +250,9 @@ namespace QuantLib {
             || (d == 2 && m == October)
             // Christmas
             || (d == 25 && m == December)
-            )
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
             return false;
-
-        if (y == 2005) {
-            // Moharram, Holi, Maharashtra Day, and Ramzan Id fall
-            // on Saturday or Sunday in 2005
-            if (// Bakri Id
-                (d == 21 && m == January)
-                // Ganesh Chaturthi
-                || (d == 7 && m == September)
-                // Dasara
-                || (d == 12 && m == October)
-                // Laxmi Puja
-                || (d == 1 && m == November)
-                // Bhaubeej
-                || (d == 3 && m == November)
-                // Guru Nanak Jayanti
-                || (d == 15 && m == November)
-                )
-                return false;
-        }
-
-        if (y == 2006) {
-            if (// Bakri Id
-                (d == 11 && m == January)
-                // Moharram
-                || (d == 9 && m == February)
-                // Holi
-                || (d == 15 && m == March)
-                // Ram Navami
-                || (d == 6 && m == April)
-                // Mahavir Jayanti
-                || (d == 11 && m == April)
-                // Maharashtra Day
-                || (d == 1 && m == May)
-                // Bhaubeej
-                || (d == 24 && m == October)
-                // Ramzan Id
-                || (d == 25 && m == October)
-                )
-                return false;
-        }
-
-        if (y == 2007) {
-            if (// Bakri Id
-                (d == 1 && m == January)
-                // Moharram
-                || (d == 30 && m == January)
-                // Mahashivratri
-                || (d == 16 && m == February)
-                // Ram Navami
-                || (d == 27 && m == March)
-                // Maharashtra Day
-                || (d == 1 && m == May)
-                // Buddha Pournima
-                || (d == 2 && m == May)
-                // Laxmi Puja
-                || (d == 9 && m == November)
-                // Bakri Id (again)
-                || (d == 21 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2008) {
-            if (// Mahashivratri
-                (d == 6 && m == March)
-                // Id-E-Milad
-                || (d == 20 && m == March)
-                // Mahavir Jayanti
-                || (d == 18 && m == April)
-                // Maharashtra Day
-                || (d == 1 && m == May)
-                // Buddha Pournima
-                || (d == 19 && m == May)
-                // Ganesh Chaturthi
-                || (d == 3 && m == September)
-                // Ramzan Id
-                || (d == 2 && m == October)
-                // Dasara
-                || (d == 9 && m == October)
-                // Laxmi Puja
-                || (d == 28 && m == October)
-                // Bhau bhij
-                || (d == 30 && m == October)
-                // Gurunanak Jayanti
-                || (d == 13 && m == November)
-                // Bakri Id
-                || (d == 9 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2009) {
-            if (// Moharram
-                (d == 8 && m == January)
-                // Mahashivratri
-                || (d == 23 && m == February)
-                // Id-E-Milad
-                || (d == 10 && m == March)
-                // Holi
-                || (d == 11 && m == March)
-                // Ram Navmi
-                || (d == 3 && m == April)
-                // Mahavir Jayanti
-                || (d == 7 && m == April)
-                // Maharashtra Day
-                || (d == 1 && m == May)
-                // Ramzan Id
-                || (d == 21 && m == September)
-                // Dasara
-                || (d == 28 && m == September)
-                // Bhau Bhij
-                || (d == 19 && m == October)
-                // Gurunanak Jayanti
-                || (d == 2 && m == November)
-                // Moharram (again)
-                || (d == 28 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2010) {
-            if (// New Year's Day
-                (d == 1 && m == January)
-                // Mahashivratri
-                || (d == 12 && m == February)
-                // Holi
-                || (d == 1 && m == March)
-                // Ram Navmi
-                || (d == 24 && m == March)
-                // Ramzan Id
-                || (d == 10 && m == September)
-                // Laxmi Puja
-                || (d == 5 && m == November)
-                // Bakri Id
-                || (d == 17 && m == November)
-                // Moharram
-                || (d == 17 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2011) {
-            if (// Mahashivratri
-                (d == 2 && m == March)
-                // Ram Navmi
-                || (d == 12 && m == April)
-                // Ramzan Id
-                || (d == 31 && m == August)
-                // Ganesh Chaturthi
-                || (d == 1 && m == September)
-                // Dasara
-                || (d == 6 && m == October)
-                // Laxmi Puja
-                || (d == 26 && m == October)
-                // Diwali - Balipratipada
-                || (d == 27 && m == October)
-                // Bakri Id
-                || (d == 7 && m == November)
-                // Gurunanak Jayanti
-                || (d == 10 && m == November)
-                // Moharram
-                || (d == 6 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2012) {
-            if (// Mahashivratri
-                (d == 20 && m == February)
-                // Holi
-                || (d == 8 && m == March)
-                // Mahavir Jayanti
-                || (d == 5 && m == April)
-                // Ramzan Id
-                || (d == 20 && m == August)
-                // Ganesh Chaturthi
-                || (d == 19 && m == September)
-                // Dasara
-                || (d == 24 && m == October)
-                // Diwali - Balipratipada
-                || (d == 14 && m == November)
-                // Gurunanak Jayanti
-                || (d == 28 && m == November)
-                )
-                return false;
-        }
-
-        if (y == 2013) {
-            if (// Holi
-                (d == 27 && m == March)
-                // Ram Navmi
-                || (d == 19 && m == April)
-                // Mahavir Jayanti
-                || (d == 24 && m == April)
-                // Ramzan Id
-                || (d == 9 && m == August)
-                // Ganesh Chaturthi
-                || (d == 9 && m == September)
-                // Bakri Id
-                || (d == 16 && m == October)
-                // Diwali - Balipratipada
-                || (d == 4 && m == November)
-                // Moharram
-                || (d == 14 && m == November)
-                )
-                return false;
-        }
-
-        if (y == 2014) {
-            if (// Mahashivratri
-                (d == 27 && m == February)
-                // Holi
-                || (d == 17 && m == March)
-                // Ram Navmi
-                || (d == 8 && m == April)
-                // Ramzan Id
-                || (d == 29 && m == July)
-                // Ganesh Chaturthi
-                || (d == 29 && m == August)
-                // Dasera
-                || (d == 3 && m == October)
-                // Bakri Id
-                || (d == 6 && m == October)
-                // Diwali - Balipratipada
-                || (d == 24 && m == October)
-                // Moharram
-                || (d == 4 && m == November)
-                // Gurunank Jayanti
-                || (d == 6 && m == November)
-                )
-                return false;
-        }
-
         return true;
     }
 
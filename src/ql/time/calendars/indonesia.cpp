@@ -18,6 +18,7 @@
 */
 
 #include <ql/time/calendars/indonesia.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -38,11 +39,200 @@ namespace QuantLib {
     }
 
     bool Indonesia::BejImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        Day dd = date.dayOfYear();
+        static const Date special_holidays[] = {
+            // Idul Adha
+            Date(21, Jan, 2005),
+            // Imlek
+            Date(9, Feb, 2005),
+            // Moslem's New Year Day
+            Date(10, Feb, 2005),
+            // Nyepi
+            Date(11, Mar, 2005),
+            // Birthday of Prophet Muhammad SAW
+            Date(22, Apr, 2005),
+            // Waisak
+            Date(24, May, 2005),
+            // Ascension of Prophet Muhammad SAW
+            Date(2, Sep, 2005),
+            // Idul Fitri
+            Date(3, Nov, 2005), Date(4, Nov, 2005),
+            // National leaves
+            Date(2, Nov, 2005), Date(7, Nov, 2005), Date(8, Nov, 2005),
+            Date(26, Dec, 2005),
+
+            // Idul Adha
+            Date(10, Jan, 2006),
+            // Moslem's New Year Day
+            Date(31, Jan, 2006),
+            // Nyepi
+            Date(30, Mar, 2006),
+            // Birthday of Prophet Muhammad SAW
+            Date(10, Apr, 2006),
+            // Ascension of Prophet Muhammad SAW
+            Date(21, Aug, 2006),
+            // Idul Fitri
+            Date(24, Oct, 2006), Date(25, Oct, 2006),
+            // National leaves
+            Date(23, Oct, 2006), Date(26, Oct, 2006), Date(27, Oct, 2006),
+
+            // Nyepi
+            Date(19, Mar, 2007),
+            // Waisak
+            Date(1, Jun, 2007),
+            // Ied Adha
+            Date(20, Dec, 2007),
+            // National leaves
+            Date(18, May, 2007),
+            Date(12, Oct, 2007), Date(15, Oct, 2007), Date(16, Oct, 2007),
+            Date(21, Oct, 2007), Date(24, Oct, 2007),
+
+            // Islamic New Year
+            Date(10, Jan, 2008), Date(11, Jan, 2008),
+            // Chinese New Year
+            Date(7, Feb, 2008), Date(8, Feb, 2008),
+            // Saka's New Year
+            Date(7, Mar, 2008),
+            // Birthday of the prophet Muhammad SAW
+            Date(20, Mar, 2008),
+            // Vesak Day
+            Date(20, May, 2008),
+            // Isra' Mi'raj of the prophet Muhammad SAW
+            Date(30, Jul, 2008),
+            // National leave
+            Date(18, Aug, 2008),
+            // Ied Fitr
+            Date(30, Sep, 2008),
+            Date(1, Oct, 2008), Date(2, Oct, 2008), Date(3, Oct, 2008),
+            // Ied Adha
+            Date(8, Dec, 2008),
+            // Islamic New Year
+            Date(29, Dec, 2008),
+            // New Year's Eve
+            Date(31, Dec, 2008),
+
+            // Public holiday
+            Date(2, Jan, 2009),
+            // Chinese New Year
+            Date(26, Jan, 2009),
+            // Birthday of the prophet Muhammad SAW
+            Date(9, Mar, 2009),
+            // Saka's New Year
+            Date(26, Mar, 2009),
+            // National leave
+            Date(9, Apr, 2009),
+            // Isra' Mi'raj of the prophet Muhammad SAW
+            Date(20, Jul, 2009),
+            // Ied Fitr
+            Date(18, Sep, 2009), Date(19, Sep, 2009), Date(20, Sep, 2009),
+            Date(21, Sep, 2009), Date(22, Sep, 2009), Date(23, Sep, 2009),
+            // Ied Adha
+            Date(27, Nov, 2009),
+            // Islamic New Year
+            Date(18, Dec, 2009),
+            // Public Holiday
+            Date(24, Dec, 2009),
+            // Trading holiday
+            Date(31, Dec, 2009),
+
+            // Birthday of the prophet Muhammad SAW
+            Date(26, Feb, 2010),
+            // Saka's New Year
+            Date(16, Mar, 2010),
+            // Birth of Buddha
+            Date(28, May, 2010),
+            // Ied Fitr
+            Date(8, Sep, 2010), Date(9, Sep, 2010), Date(10, Sep, 2010),
+            Date(11, Sep, 2010), Date(12, Sep, 2010), Date(13, Sep, 2010),
+            Date(14, Sep, 2010),
+            // Ied Adha
+            Date(17, Nov, 2010),
+            // Islamic New Year
+            Date(7, Dec, 2010),
+            // Public Holiday
+            Date(24, Dec, 2010),
+            // Trading holiday
+            Date(31, Dec, 2010),
+
+            // Chinese New Year
+            Date(3, Feb, 2011),
+            // Birthday of the prophet Muhammad SAW
+            Date(15, Feb, 2011),
+            // Birth of Buddha
+            Date(17, May, 2011),
+            // Isra' Mi'raj of the prophet Muhammad SAW
+            Date(29, Jun, 2011),
+            // Ied Fitr
+            Date(29, Aug, 2011), Date(30, Aug, 2011), Date(31, Aug, 2011),
+            Date(1, Sep, 2011), Date(2, Sep, 2011),
+            // Public Holiday
+            Date(26, Dec, 2011),
+
+            // Chinese New Year
+            Date(23, Jan, 2012),
+            // Saka New Year
+            Date(23, Mar, 2012),
+            // Ied ul-Fitr
+            Date(20, Aug, 2012), Date(21, Aug, 2012), Date(22, Aug, 2012),
+            // Eid ul-Adha
+            Date(26, Oct, 2012),
+            // Islamic New Year
+            Date(15, Nov, 2012), Date(16, Nov, 2012),
+            // Public Holiday
+            Date(24, Dec, 2012),
+            // Trading Holiday
+            Date(31, Dec, 2012),
+
+            // Birthday of the prophet Muhammad SAW
+            Date(24, Jan, 2013),
+            // Saka New Year
+            Date(12, Mar, 2013),
+            // Isra' Mi'raj of the prophet Muhammad SAW
+            Date(6, Jun, 2013),
+            // Ied ul-Fitr
+            Date(5, Aug, 2013), Date(6, Aug, 2013), Date(7, Aug, 2013),
+            Date(8, Aug, 2013), Date(9, Aug, 2013),
+            // Eid ul-Adha
+            Date(14, Oct, 2013), Date(15, Oct, 2013),
+            // Islamic New Year
+            Date(5, Nov, 2013),
+            // Public Holiday
+            Date(26, Dec, 2013),
+            // Trading Holiday
+            Date(31, Dec, 2013),
+
+            // Birthday of the prophet Muhammad SAW
+            Date(14, Jan, 2014),
+            // Chinese New Year
+            Date(31, Jan, 2014),
+            // Saka New Year
+            Date(31, Mar, 2014),
+            // Labour Day
+            Date(1, May, 2014),
+            // Birth of Buddha
+            Date(15, May, 2014),
+            // Isra' Mi'raj of the prophet Muhammad SAW
+            Date(27, May, 2014),
+            // Ascension Day of Jesus Christ
+            Date(29, May, 2014),
+            // Ied ul-Fitr
+            Date(28, Jul, 2014), Date(29, Jul, 2014), Date(30, Jul, 2014),
+            Date(31, Jul, 2014), Date(1, Aug, 2014),
+            // Public Holiday
+            Date(26, Dec, 2014),
+            // Trading Holiday
+            Date(31, Dec, 2014)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Day dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
         Day em = easterMonday(y);
 
         if (isWeekend(w)
@@ -56,226 +246,9 @@ namespace QuantLib {
             || (d == 17 && m == August)
             // Christmas
             || (d == 25 && m == December)
-            )
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
             return false;
-
-        if (y == 2005) {
-            if (// Idul Adha
-                (d == 21 && m == January)
-                // Imlek
-                || (d == 9 && m == February)
-                // Moslem's New Year Day
-                || (d == 10 && m == February)
-                // Nyepi
-                || (d == 11 && m == March)
-                // Birthday of Prophet Muhammad SAW
-                || (d == 22 && m == April)
-                // Waisak
-                || (d == 24 && m == May)
-                // Ascension of Prophet Muhammad SAW
-                || (d == 2 && m == September)
-                // Idul Fitri
-                || ((d == 3 || d == 4) && m == November)
-                // National leaves
-                || ((d == 2 || d == 7 || d == 8) && m == November)
-                || (d == 26 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2006) {
-            if (// Idul Adha
-                (d == 10 && m == January)
-                // Moslem's New Year Day
-                || (d == 31 && m == January)
-                // Nyepi
-                || (d == 30 && m == March)
-                // Birthday of Prophet Muhammad SAW
-                || (d == 10 && m == April)
-                // Ascension of Prophet Muhammad SAW
-                || (d == 21 && m == August)
-                // Idul Fitri
-                || ((d == 24 || d == 25) && m == October)
-                // National leaves
-                || ((d == 23 || d == 26 || d == 27) && m == October)
-                )
-                return false;
-        }
-
-        if (y == 2007) {
-            if (// Nyepi
-                (d == 19 && m == March)
-                // Waisak
-                || (d == 1 && m == June)
-                // Ied Adha
-                || (d == 20 && m == December)
-                // National leaves
-                || (d == 18 && m == May)
-                || ((d == 12 || d == 15 || d == 16) && m == October)
-                || ((d == 21 || d == 24) && m == October)
-                )
-                return false;
-        }
-
-        if (y == 2008) {
-            if (// Islamic New Year
-                ((d == 10 || d == 11) && m == January)
-                // Chinese New Year
-                || ((d == 7 || d == 8) && m == February)
-                // Saka's New Year
-                || (d == 7 && m == March)
-                // Birthday of the prophet Muhammad SAW
-                || (d == 20 && m == March)
-                // Vesak Day
-                || (d == 20 && m == May)
-                // Isra' Mi'raj of the prophet Muhammad SAW
-                || (d == 30 && m == July)
-                // National leave
-                || (d == 18 && m == August)
-                // Ied Fitr
-                || (d == 30 && m == September)
-                || ((d == 1 || d == 2 || d == 3) && m == October)
-                // Ied Adha
-                || (d == 8 && m == December)
-                // Islamic New Year
-                || (d == 29 && m == December)
-                // New Year's Eve
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2009) {
-            if (// Public holiday
-                (d == 2 && m == January)
-                // Chinese New Year
-                || (d == 26 && m == January)
-                // Birthday of the prophet Muhammad SAW
-                || (d == 9 && m == March)
-                // Saka's New Year
-                || (d == 26 && m == March)
-                // National leave
-                || (d == 9 && m == April)
-                // Isra' Mi'raj of the prophet Muhammad SAW
-                || (d == 20 && m == July)
-                // Ied Fitr
-                || (d >= 18 && d <= 23 && m == September)
-                // Ied Adha
-                || (d == 27 && m == November)
-                // Islamic New Year
-                || (d == 18 && m == December)
-                // Public Holiday
-                || (d == 24 && m == December)
-                // Trading holiday
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2010) {
-            if (// Birthday of the prophet Muhammad SAW
-                   (d == 26 && m == February)
-                // Saka's New Year
-                || (d == 16 && m == March)
-                // Birth of Buddha
-                || (d == 28 && m == May)
-                // Ied Fitr
-                || (d >= 8 && d <= 14 && m == September)
-                // Ied Adha
-                || (d == 17 && m == November)
-                // Islamic New Year
-                || (d == 7 && m == December)
-                // Public Holiday
-                || (d == 24 && m == December)
-                // Trading holiday
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2011) {
-            if (// Chinese New Year
-                   (d == 3 && m == February)
-                // Birthday of the prophet Muhammad SAW
-                || (d == 15 && m == February)
-                // Birth of Buddha
-                || (d == 17 && m == May)
-                // Isra' Mi'raj of the prophet Muhammad SAW
-                || (d == 29 && m == June)
-                // Ied Fitr
-                || (d >= 29 && m == August)
-                || (d <= 2 && m == September)
-                // Public Holiday
-                || (d == 26 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2012) {
-            if (// Chinese New Year
-                (d == 23 && m == January)
-                // Saka New Year
-                || (d == 23 && m == March)
-                // Ied ul-Fitr
-                || (d >= 20 && d <= 22 && m == August)
-                // Eid ul-Adha
-                || (d == 26 && m == October)
-                // Islamic New Year
-                || (d >= 15 && d <= 16 && m == November)
-                // Public Holiday
-                || (d == 24 && m == December)
-                // Trading Holiday
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2013) {
-            if (// Birthday of the prophet Muhammad SAW
-                (d == 24 && m == January)
-                // Saka New Year
-                || (d == 12 && m == March)
-                // Isra' Mi'raj of the prophet Muhammad SAW
-                || (d == 6 && m == June)
-                // Ied ul-Fitr
-                || (d >= 5 && d <= 9 && m == August)
-                // Eid ul-Adha
-                || (d >= 14 && d <= 15 && m == October)
-                // Islamic New Year
-                || (d == 5 && m == November)
-                // Public Holiday
-                || (d == 26 && m == December)
-                // Trading Holiday
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
-        if (y == 2014) {
-            if (// Birthday of the prophet Muhammad SAW
-                (d == 14 && m == January)
-                // Chinese New Year
-                || (d == 31 && m == January)
-                // Saka New Year
-                || (d == 31 && m == March)
-                // Labour Day
-                || (d == 1 && m == May)
-                // Birth of Buddha
-                || (d == 15 && m == May)
-                // Isra' Mi'raj of the prophet Muhammad SAW
-                || (d == 27 && m == May)
-                // Ascension Day of Jesus Christ
-                || (d == 29 && m == May)
-                // Ied ul-Fitr
-                || ((d >= 28 && m == July) || (d == 1 && m == August))
-                // Public Holiday
-                || (d == 26 && m == December)
-                // Trading Holiday
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
-
         return true;
     }
 
@@ -19,6 +19,7 @@
 */
 
 #include <ql/time/calendars/israel.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -41,316 +42,323 @@ namespace QuantLib {
         }
     }
 
-    bool Israel::TelAvivImpl::isWeekend(Weekday w) const {
-        return w == Friday || w == Saturday;
-    }
-
     bool Israel::TelAvivImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-
-        if (isWeekend(w)
+        static const Date special_holidays[] = {
             //Purim
-            || (d == 24 && m == February && y == 2013)
-            || (d == 16 && m == March    && y == 2014)
-            || (d == 05 && m == March    && y == 2015)
-            || (d == 24 && m == March    && y == 2016)
-            || (d == 12 && m == March    && y == 2017)
-            || (d == 1  && m == March    && y == 2018)
-            || (d == 21 && m == March    && y == 2019)
-            || (d == 10 && m == March    && y == 2020)
-            || (d == 26 && m == February && y == 2021)
-            || (d == 17 && m == March    && y == 2022)
-            || (d == 7  && m == March    && y == 2023)
-            || (d == 24 && m == March    && y == 2024)
-            || (d == 14 && m == March    && y == 2025)
-            || (d == 3  && m == March    && y == 2026)
-            || (d == 23 && m == March    && y == 2027)
-            || (d == 12 && m == March    && y == 2028)
-            || (d == 1  && m == March    && y == 2029)
-            || (d == 19 && m == March    && y == 2030)
-            || (d == 9  && m == March    && y == 2031)
-            || (d == 26 && m == February && y == 2032)
-            || (d == 15 && m == March    && y == 2033)
-            || (d == 5  && m == March    && y == 2034)
-            || (d == 25 && m == March    && y == 2035)
-            || (d == 13 && m == March    && y == 2036)
-            || (d == 1  && m == March    && y == 2037)
-            || (d == 21 && m == March    && y == 2038)
-            || (d == 10 && m == March    && y == 2039)
-            || (d == 28 && m == February && y == 2040)
-            || (d == 17 && m == March    && y == 2041)
-            || (d == 6  && m == March    && y == 2042)
-            || (d == 26 && m == March    && y == 2043)
-            || (d == 13 && m == March    && y == 2044)
+            Date(24, Feb, 2013),
+            Date(16, Mar, 2014),
+            Date(5, Mar, 2015),
+            Date(24, Mar, 2016),
+            Date(12, Mar, 2017),
+            Date(1, Mar, 2018),
+            Date(21, Mar, 2019),
+            Date(10, Mar, 2020),
+            Date(26, Feb, 2021),
+            Date(17, Mar, 2022),
+            Date(7, Mar, 2023),
+            Date(24, Mar, 2024),
+            Date(14, Mar, 2025),
+            Date(3, Mar, 2026),
+            Date(23, Mar, 2027),
+            Date(12, Mar, 2028),
+            Date(1, Mar, 2029),
+            Date(19, Mar, 2030),
+            Date(9, Mar, 2031),
+            Date(26, Feb, 2032),
+            Date(15, Mar, 2033),
+            Date(5, Mar, 2034),
+            Date(25, Mar, 2035),
+            Date(13, Mar, 2036),
+            Date(1, Mar, 2037),
+            Date(21, Mar, 2038),
+            Date(10, Mar, 2039),
+            Date(28, Feb, 2040),
+            Date(17, Mar, 2041),
+            Date(6, Mar, 2042),
+            Date(26, Mar, 2043),
+            Date(13, Mar, 2044),
             //Passover I and Passover VII
-            || ((((d==25||d==26||d==31)&&m==March)||(d==1&&m==April))&&y==2013)
-            || ((d==14||d==15||d==20||d==21) && m == April && y == 2014)
-            || ((d==3 ||d==4 ||d==9 ||d==10) && m == April && y == 2015)
-            || ((d==22||d==23||d==28||d==29) && m == April && y == 2016)
-            || ((d==10||d==11||d==16||d==17) && m == April && y == 2017)
-            || (( (d==31&&m==March) ||((d==5||d==6)&&m==April))&&y== 2018)
-            || ((d == 20||d == 25 ||d == 26) && m == April && y == 2019)
-            || ((d==8 ||d==9 ||d==14||d==15) && m == April && y == 2020)
-            || (((d==28&&m==March)||(d==3&&m==April))&&y== 2021)
-            || ((d == 16 || d == 22) && m == April && y == 2022)
-            || ((d == 6  || d == 12) && m == April && y == 2023)
-            || ((d == 23 || d == 29) && m == April && y == 2024)
-            || ((d == 13 || d == 19) && m == April && y == 2025)
-            || ((d == 2  || d == 8 ) && m == April && y == 2026)
-            || ((d == 22 || d == 28) && m == April && y == 2027)
-            || ((d == 11 || d == 17) && m == April && y == 2028)
-            || (((d==31&&m==March)||(d==6&&m==April))&&y== 2029)
-            || ((d == 18 || d == 24) && m == April && y == 2030)
-            || ((d == 8  || d == 14) && m == April && y == 2031)
-            || (((d==27&&m==March)||(d==2&&m==April))&&y== 2032)
-            || ((d == 14 || d == 20) && m == April && y == 2033)
-            || ((d == 4  || d == 10) && m == April && y == 2034)
-            || ((d == 24 || d == 30) && m == April && y == 2035)
-            || ((d == 12 || d == 18) && m == April && y == 2036)
-            || (((d==31&&m==March)||(d==6&&m==April))&&y== 2037)
-            || ((d == 20 || d == 26) && m == April && y == 2038)
-            || ((d == 9  || d == 15) && m == April && y == 2039)
-            || (((d==29&&m==March)||(d==4&&m==April))&&y== 2040)
-            || ((d == 16 || d == 22) && m == April && y == 2041)
-            || ((d == 5  || d == 11) && m == April && y == 2042)
-            || (((d==25&&m==April)||(d==1&&m==May))&& y == 2043)
-            || ((d == 12 || d == 18) && m == April && y == 2044)
+            Date(25, Mar, 2013), Date(26, Mar, 2013), Date(31, Mar, 2013),
+            Date(1, Apr, 2013),
+            Date(14, Apr, 2014), Date(15, Apr, 2014), Date(20, Apr, 2014),
+            Date(21, Apr, 2014),
+            Date(3, Apr, 2015), Date(4, Apr, 2015), Date(9, Apr, 2015),
+            Date(10, Apr, 2015),
+            Date(22, Apr, 2016), Date(23, Apr, 2016), Date(28, Apr, 2016),
+            Date(29, Apr, 2016),
+            Date(10, Apr, 2017), Date(11, Apr, 2017), Date(16, Apr, 2017),
+            Date(17, Apr, 2017),
+            Date(31, Mar, 2018), Date(5, Apr, 2018), Date(6, Apr, 2018),
+            Date(20, Apr, 2019), Date(25, Apr, 2019), Date(26, Apr, 2019),
+            Date(8, Apr, 2020), Date(9, Apr, 2020), Date(14, Apr, 2020),
+            Date(15, Apr, 2020),
+            Date(28, Mar, 2021), Date(3, Apr, 2021),
+            Date(16, Apr, 2022), Date(22, Apr, 2022),
+            Date(6, Apr, 2023), Date(12, Apr, 2023),
+            Date(23, Apr, 2024), Date(29, Apr, 2024),
+            Date(13, Apr, 2025), Date(19, Apr, 2025),
+            Date(2, Apr, 2026), Date(8, Apr, 2026),
+            Date(22, Apr, 2027), Date(28, Apr, 2027),
+            Date(11, Apr, 2028), Date(17, Apr, 2028),
+            Date(31, Mar, 2029), Date(6, Apr, 2029),
+            Date(18, Apr, 2030), Date(24, Apr, 2030),
+            Date(8, Apr, 2031), Date(14, Apr, 2031),
+            Date(27, Mar, 2032), Date(2, Apr, 2032),
+            Date(14, Apr, 2033), Date(20, Apr, 2033),
+            Date(4, Apr, 2034), Date(10, Apr, 2034),
+            Date(24, Apr, 2035), Date(30, Apr, 2035),
+            Date(12, Apr, 2036), Date(18, Apr, 2036),
+            Date(31, Mar, 2037), Date(6, Apr, 2037),
+            Date(20, Apr, 2038), Date(26, Apr, 2038),
+            Date(9, Apr, 2039), Date(15, Apr, 2039),
+            Date(29, Mar, 2040), Date(4, Apr, 2040),
+            Date(16, Apr, 2041), Date(22, Apr, 2041),
+            Date(5, Apr, 2042), Date(11, Apr, 2042),
+            Date(25, Apr, 2043), Date(1, May, 2043),
+            Date(12, Apr, 2044), Date(18, Apr, 2044),
             //Memorial and Indipendence Day
-            || ((d == 15 || d == 16) && m == April && y == 2013)
-            || ((d == 5  || d == 6 ) && m == May   && y == 2014)
-            || ((d == 22 || d == 23) && m == April && y == 2015)
-            || ((d == 11 || d == 12) && m == May   && y == 2016)
-            || ((d == 1  || d == 2 ) && m == May   && y == 2017)
-            || ((d == 18 || d == 19) && m == April && y == 2018)
-            || ((d == 8  || d == 9 ) && m == May   && y == 2019)
-            || ((d == 28 || d == 29) && m == April && y == 2020)
-            || ((d == 14 || d == 15) && m == April && y == 2021)
-            || ((d == 4  || d == 5 ) && m == May   && y == 2022)
-            || ((d == 25 || d == 26) && m == April && y == 2023)
-            || ((d == 13 || d == 14) && m == May   && y == 2024)
-            || (((d==30&&m==April)||(d==1&&m==May))&& y == 2025)
-            || ((d == 21 || d == 22) && m == April && y == 2026)
-            || ((d == 11 || d == 12) && m == May   && y == 2027)
-            || ((d == 1  || d == 2 ) && m == May   && y == 2028)
-            || ((d == 18 || d == 19) && m == April && y == 2029)
-            || ((d == 7  || d == 8 ) && m == May   && y == 2030)
-            || ((d == 28 || d == 29) && m == April && y == 2031)
-            || ((d == 14 || d == 15) && m == April && y == 2032)
-            || ((d == 3  || d == 4 ) && m == May   && y == 2033)
-            || ((d == 24 || d == 25) && m == April && y == 2034)
-            || ((d == 14 || d == 15) && m == May   && y == 2035)
-            || (((d==30&&m==April)||(d==1&&m==May))&& y == 2036)
-            || ((d == 20 || d == 21) && m == April && y == 2037)
-            || ((d == 9  || d == 10) && m == May   && y == 2038)
-            || ((d == 27 || d == 28) && m == April && y == 2039)
-            || ((d == 17 || d == 18) && m == April && y == 2040)
-            || ((d == 6  || d == 7 ) && m == May   && y == 2041)
-            || ((d == 23 || d == 24) && m == April && y == 2042)
-            || ((d == 13 || d == 14) && m == May   && y == 2043)
-            || ((d == 2  || d == 3 ) && m == May   && y == 2044)
+            Date(15, Apr, 2013), Date(16, Apr, 2013),
+            Date(5, May, 2014), Date(6, May, 2014),
+            Date(22, Apr, 2015), Date(23, Apr, 2015),
+            Date(11, May, 2016), Date(12, May, 2016),
+            Date(1, May, 2017), Date(2, May, 2017),
+            Date(18, Apr, 2018), Date(19, Apr, 2018),
+            Date(8, May, 2019), Date(9, May, 2019),
+            Date(28, Apr, 2020), Date(29, Apr, 2020),
+            Date(14, Apr, 2021), Date(15, Apr, 2021),
+            Date(4, May, 2022), Date(5, May, 2022),
+            Date(25, Apr, 2023), Date(26, Apr, 2023),
+            Date(13, May, 2024), Date(14, May, 2024),
+            Date(30, Apr, 2025), Date(1, May, 2025),
+            Date(21, Apr, 2026), Date(22, Apr, 2026),
+            Date(11, May, 2027), Date(12, May, 2027),
+            Date(1, May, 2028), Date(2, May, 2028),
+            Date(18, Apr, 2029), Date(19, Apr, 2029),
+            Date(7, May, 2030), Date(8, May, 2030),
+            Date(28, Apr, 2031), Date(29, Apr, 2031),
+            Date(14, Apr, 2032), Date(15, Apr, 2032),
+            Date(3, May, 2033), Date(4, May, 2033),
+            Date(24, Apr, 2034), Date(25, Apr, 2034),
+            Date(14, May, 2035), Date(15, May, 2035),
+            Date(30, Apr, 2036), Date(1, May, 2036),
+            Date(20, Apr, 2037), Date(21, Apr, 2037),
+            Date(9, May, 2038), Date(10, May, 2038),
+            Date(27, Apr, 2039), Date(28, Apr, 2039),
+            Date(17, Apr, 2040), Date(18, Apr, 2040),
+            Date(6, May, 2041), Date(7, May, 2041),
+            Date(23, Apr, 2042), Date(24, Apr, 2042),
+            Date(13, May, 2043), Date(14, May, 2043),
+            Date(2, May, 2044), Date(3, May, 2044),
             //Pentecost (Shavuot)
-            || ((d == 14 || d == 15) && m == May  && y == 2013)
-            || ((d == 3  || d == 4 ) && m == June && y == 2014)
-            || ((d == 23 || d == 24) && m == May  && y == 2015)
-            || ((d == 11 || d == 12) && m == June && y == 2016)
-            || ((d == 30 || d == 31) && m == May  && y == 2017)
-            || ((d == 19 || d == 20) && m == May  && y == 2018)
-            || ((d == 8  || d == 9 ) && m == June && y == 2019)
-            || ((d == 28 || d == 29) && m == May  && y == 2020)
-            || (d == 17 && m == May  && y == 2021)
-            || (d == 5  && m == June && y == 2022)
-            || (d == 26 && m == May  && y == 2023)
-            || (d == 12 && m == June && y == 2024)
-            || (d == 2  && m == June && y == 2025)
-            || (d == 22 && m == May  && y == 2026)
-            || (d == 11 && m == June && y == 2027)
-            || (d == 31 && m == May  && y == 2028)
-            || (d == 20 && m == May  && y == 2029)
-            || (d == 7  && m == June && y == 2030)
-            || (d == 28 && m == May  && y == 2031)
-            || (d == 16 && m == May  && y == 2032)
-            || (d == 3  && m == June && y == 2033)
-            || (d == 24 && m == May  && y == 2034)
-            || (d == 13 && m == June && y == 2035)
-            || (d == 1  && m == June && y == 2036)
-            || (d == 20 && m == May  && y == 2037)
-            || (d == 9  && m == June && y == 2038)
-            || (d == 29 && m == May  && y == 2039)
-            || (d == 18 && m == May  && y == 2040)
-            || (d == 5  && m == June && y == 2041)
-            || (d == 25 && m == May  && y == 2042)
-            || (d == 14 && m == June && y == 2043)
-            || (d == 1  && m == June && y == 2044)
+            Date(14, May, 2013), Date(15, May, 2013),
+            Date(3, Jun, 2014), Date(4, Jun, 2014),
+            Date(23, May, 2015), Date(24, May, 2015),
+            Date(11, Jun, 2016), Date(12, Jun, 2016),
+            Date(30, May, 2017), Date(31, May, 2017),
+            Date(19, May, 2018), Date(20, May, 2018),
+            Date(8, Jun, 2019), Date(9, Jun, 2019),
+            Date(28, May, 2020), Date(29, May, 2020),
+            Date(17, May, 2021),
+            Date(5, Jun, 2022),
+            Date(26, May, 2023),
+            Date(12, Jun, 2024),
+            Date(2, Jun, 2025),
+            Date(22, May, 2026),
+            Date(11, Jun, 2027),
+            Date(31, May, 2028),
+            Date(20, May, 2029),
+            Date(7, Jun, 2030),
+            Date(28, May, 2031),
+            Date(16, May, 2032),
+            Date(3, Jun, 2033),
+            Date(24, May, 2034),
+            Date(13, Jun, 2035),
+            Date(1, Jun, 2036),
+            Date(20, May, 2037),
+            Date(9, Jun, 2038),
+            Date(29, May, 2039),
+            Date(18, May, 2040),
+            Date(5, Jun, 2041),
+            Date(25, May, 2042),
+            Date(14, Jun, 2043),
+            Date(1, Jun, 2044),
             //Fast Day
-            || (d == 16 && m == July   && y == 2013)
-            || (d == 5  && m == August && y == 2014)
-            || (d == 26 && m == July   && y == 2015)
-            || (d == 14 && m == August && y == 2016)
-            || (d == 1  && m == August && y == 2017)
-            || (d == 22 && m == July   && y == 2018)
-            || (d == 11 && m == August && y == 2019)
-            || (d == 30 && m == July   && y == 2020)
-            || (d == 18 && m == July   && y == 2021)
-            || (d == 7  && m == August && y == 2022)
-            || (d == 27 && m == July   && y == 2023)
-            || (d == 13 && m == August && y == 2024)
-            || (d == 3  && m == August && y == 2025)
-            || (d == 23 && m == July   && y == 2026)
-            || (d == 12 && m == August && y == 2027)
-            || (d == 1  && m == August && y == 2028)
-            || (d == 22 && m == July   && y == 2029)
-            || (d == 8  && m == August && y == 2030)
-            || (d == 29 && m == July   && y == 2031)
-            || (d == 18 && m == July   && y == 2032)
-            || (d == 4  && m == August && y == 2033)
-            || (d == 25 && m == July   && y == 2034)
-            || (d == 14 && m == August && y == 2035)
-            || (d == 3  && m == August && y == 2036)
-            || (d == 21 && m == July   && y == 2037)
-            || (d == 10 && m == August && y == 2038)
-            || (d == 31 && m == July   && y == 2039)
-            || (d == 19 && m == July   && y == 2040)
-            || (d == 6  && m == August && y == 2041)
-            || (d == 27 && m == July   && y == 2042)
-            || (d == 16 && m == August && y == 2043)
-            || (d == 2  && m == August && y == 2044)
+            Date(16, Jul, 2013),
+            Date(5, Aug, 2014),
+            Date(26, Jul, 2015),
+            Date(14, Aug, 2016),
+            Date(1, Aug, 2017),
+            Date(22, Jul, 2018),
+            Date(11, Aug, 2019),
+            Date(30, Jul, 2020),
+            Date(18, Jul, 2021),
+            Date(7, Aug, 2022),
+            Date(27, Jul, 2023),
+            Date(13, Aug, 2024),
+            Date(3, Aug, 2025),
+            Date(23, Jul, 2026),
+            Date(12, Aug, 2027),
+            Date(1, Aug, 2028),
+            Date(22, Jul, 2029),
+            Date(8, Aug, 2030),
+            Date(29, Jul, 2031),
+            Date(18, Jul, 2032),
+            Date(4, Aug, 2033),
+            Date(25, Jul, 2034),
+            Date(14, Aug, 2035),
+            Date(3, Aug, 2036),
+            Date(21, Jul, 2037),
+            Date(10, Aug, 2038),
+            Date(31, Jul, 2039),
+            Date(19, Jul, 2040),
+            Date(6, Aug, 2041),
+            Date(27, Jul, 2042),
+            Date(16, Aug, 2043),
+            Date(2, Aug, 2044),
             //Jewish New Year
-            || ((d == 4  ||d == 5 || d == 6 ) && m == September && y == 2013)
-            || ((d == 24 ||d == 25|| d == 26) && m == September && y == 2014)
-            || ((d == 13 ||d == 14|| d == 15) && m == September && y == 2015)
-            || ((d == 2  ||d == 3 || d == 4 ) && m == October   && y == 2016)
-            || ((d == 20 ||d == 21|| d == 22) && m == September && y == 2017)
-            || ((d == 9  ||d == 10|| d == 11) && m == September && y == 2018)
-            || ((((d==29||d==30)&&m==September)||(d==1&&m==October))&&y==2019)
-            || ((d == 19 || d == 20) && m == September && y == 2020)
-            || ((d == 7  || d == 8 ) && m == September && y == 2021)
-            || ((d == 26 || d == 27) && m == September && y == 2022)
-            || ((d == 16 || d == 17) && m == September && y == 2023)
-            || ((d == 3  || d == 4 ) && m == October   && y == 2024)
-            || ((d == 23 || d == 24) && m == September && y == 2025)
-            || ((d == 12 || d == 13) && m == September && y == 2026)
-            || ((d == 2  || d == 3 ) && m == October   && y == 2027)
-            || ((d == 21 || d == 22) && m == September && y == 2028)
-            || ((d == 10 || d == 11) && m == September && y == 2029)
-            || ((d == 28 || d == 29) && m == September && y == 2030)
-            || ((d == 18 || d == 19) && m == September && y == 2031)
-            || ((d == 6  || d == 7 ) && m == September && y == 2032)
-            || ((d == 24 || d == 25) && m == September && y == 2033)
-            || ((d == 14 || d == 15) && m == September && y == 2034)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2035)
-            || ((d == 22 || d == 23) && m == September && y == 2036)
-            || ((d == 10 || d == 11) && m == September && y == 2037)
-            || (((d==30&&m==September)||(d==01&&m==October))&&y==2038)
-            || ((d == 19 || d == 20) && m == September && y == 2039)
-            || ((d == 8  || d == 9 ) && m == September && y == 2040)
-            || ((d == 26 || d == 27) && m == September && y == 2041)
-            || ((d == 15 || d == 16) && m == September && y == 2042)
-            || ((d == 5  || d == 6 ) && m == October   && y == 2043)
-            || ((d == 22 || d == 23) && m == September && y == 2044)
+            Date(4, Sep, 2013), Date(5, Sep, 2013), Date(6, Sep, 2013),
+            Date(24, Sep, 2014), Date(25, Sep, 2014), Date(26, Sep, 2014),
+            Date(13, Sep, 2015), Date(14, Sep, 2015), Date(15, Sep, 2015),
+            Date(2, Oct, 2016), Date(3, Oct, 2016), Date(4, Oct, 2016),
+            Date(20, Sep, 2017), Date(21, Sep, 2017), Date(22, Sep, 2017),
+            Date(9, Sep, 2018), Date(10, Sep, 2018), Date(11, Sep, 2018),
+            Date(29, Sep, 2019), Date(30, Sep, 2019), Date(1, Oct, 2019),
+            Date(19, Sep, 2020), Date(20, Sep, 2020),
+            Date(7, Sep, 2021), Date(8, Sep, 2021),
+            Date(26, Sep, 2022), Date(27, Sep, 2022),
+            Date(16, Sep, 2023), Date(17, Sep, 2023),
+            Date(3, Oct, 2024), Date(4, Oct, 2024),
+            Date(23, Sep, 2025), Date(24, Sep, 2025),
+            Date(12, Sep, 2026), Date(13, Sep, 2026),
+            Date(2, Oct, 2027), Date(3, Oct, 2027),
+            Date(21, Sep, 2028), Date(22, Sep, 2028),
+            Date(10, Sep, 2029), Date(11, Sep, 2029),
+            Date(28, Sep, 2030), Date(29, Sep, 2030),
+            Date(18, Sep, 2031), Date(19, Sep, 2031),
+            Date(6, Sep, 2032), Date(7, Sep, 2032),
+            Date(24, Sep, 2033), Date(25, Sep, 2033),
+            Date(14, Sep, 2034), Date(15, Sep, 2034),
+            Date(4, Oct, 2035), Date(5, Oct, 2035),
+            Date(22, Sep, 2036), Date(23, Sep, 2036),
+            Date(10, Sep, 2037), Date(11, Sep, 2037),
+            Date(30, Sep, 2038), Date(1, Oct, 2038),
+            Date(19, Sep, 2039), Date(20, Sep, 2039),
+            Date(8, Sep, 2040), Date(9, Sep, 2040),
+            Date(26, Sep, 2041), Date(27, Sep, 2041),
+            Date(15, Sep, 2042), Date(16, Sep, 2042),
+            Date(5, Oct, 2043), Date(6, Oct, 2043),
+            Date(22, Sep, 2044), Date(23, Sep, 2044),
             //Yom Kippur
-            || ((d == 13 || d == 14) && m == September && y == 2013)
-            || ((d == 3  || d == 4 ) && m == October   && y == 2014)
-            || ((d == 22 || d == 23) && m == September && y == 2015)
-            || ((d == 11 || d == 12) && m == October   && y == 2016)
-            || ((d == 29 || d == 30) && m == September && y == 2017)
-            || ((d == 18 || d == 19) && m == September && y == 2018)
-            || ((d == 8  || d == 9 ) && m == October   && y == 2019)
-            || ((d == 27 || d == 28) && m == September && y == 2020)
-            || ((d == 15 || d == 16) && m == September && y == 2021)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2022)
-            || ((d == 24 || d == 25) && m == September && y == 2023)
-            || ((d == 11 || d == 12) && m == October   && y == 2024)
-            || ((d == 1  || d == 2 ) && m == October   && y == 2025)
-            || ((d == 20 || d == 21) && m == September && y == 2026)
-            || ((d == 10 || d == 11) && m == October   && y == 2027)
-            || ((d == 29 || d == 30) && m == September && y == 2028)
-            || ((d == 18 || d == 19) && m == September && y == 2029)
-            || ((d == 6  || d == 7 ) && m == October   && y == 2030)
-            || ((d == 26 || d == 27) && m == September && y == 2031)
-            || ((d == 14 || d == 15) && m == September && y == 2032)
-            || ((d == 2  || d == 3 ) && m == October   && y == 2033)
-            || ((d == 22 || d == 23) && m == September && y == 2034)
-            || ((d == 12 || d == 13) && m == October   && y == 2035)
-            || (((d==30&&m==September)||(d==01&&m==October))&&y==2036)
-            || ((d == 18 || d == 19) && m == September && y == 2037)
-            || ((d == 8  || d == 9 ) && m == October   && y == 2038)
-            || ((d == 27 || d == 28) && m == September && y == 2039)
-            || ((d == 16 || d == 17) && m == September && y == 2040)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2041)
-            || ((d == 23 || d == 24) && m == September && y == 2042)
-            || ((d == 13 || d == 14) && m == October   && y == 2043)
-            || (((d==30&&m==September)||(d==01&&m==October))&&y==2044)
+            Date(13, Sep, 2013), Date(14, Sep, 2013),
+            Date(3, Oct, 2014), Date(4, Oct, 2014),
+            Date(22, Sep, 2015), Date(23, Sep, 2015),
+            Date(11, Oct, 2016), Date(12, Oct, 2016),
+            Date(29, Sep, 2017), Date(30, Sep, 2017),
+            Date(18, Sep, 2018), Date(19, Sep, 2018),
+            Date(8, Oct, 2019), Date(9, Oct, 2019),
+            Date(27, Sep, 2020), Date(28, Sep, 2020),
+            Date(15, Sep, 2021), Date(16, Sep, 2021),
+            Date(4, Oct, 2022), Date(5, Oct, 2022),
+            Date(24, Sep, 2023), Date(25, Sep, 2023),
+            Date(11, Oct, 2024), Date(12, Oct, 2024),
+            Date(1, Oct, 2025), Date(2, Oct, 2025),
+            Date(20, Sep, 2026), Date(21, Sep, 2026),
+            Date(10, Oct, 2027), Date(11, Oct, 2027),
+            Date(29, Sep, 2028), Date(30, Sep, 2028),
+            Date(18, Sep, 2029), Date(19, Sep, 2029),
+            Date(6, Oct, 2030), Date(7, Oct, 2030),
+            Date(26, Sep, 2031), Date(27, Sep, 2031),
+            Date(14, Sep, 2032), Date(15, Sep, 2032),
+            Date(2, Oct, 2033), Date(3, Oct, 2033),
+            Date(22, Sep, 2034), Date(23, Sep, 2034),
+            Date(12, Oct, 2035), Date(13, Oct, 2035),
+            Date(30, Sep, 2036), Date(1, Oct, 2036),
+            Date(18, Sep, 2037), Date(19, Sep, 2037),
+            Date(8, Oct, 2038), Date(9, Oct, 2038),
+            Date(27, Sep, 2039), Date(28, Sep, 2039),
+            Date(16, Sep, 2040), Date(17, Sep, 2040),
+            Date(4, Oct, 2041), Date(5, Oct, 2041),
+            Date(23, Sep, 2042), Date(24, Sep, 2042),
+            Date(13, Oct, 2043), Date(14, Oct, 2043),
+            Date(30, Sep, 2044), Date(1, Oct, 2044),
             //Sukkoth
-            || ((d == 18 || d == 19) && m == September && y == 2013)
-            || ((d == 8  || d == 9 ) && m == October   && y == 2014)
-            || ((d == 27 || d == 28) && m == September && y == 2015)
-            || ((d == 16 || d == 17) && m == October   && y == 2016)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2017)
-            || ((d == 23 || d == 24) && m == September && y == 2018)
-            || ((d == 13 || d == 14) && m == October   && y == 2019)
-            || ((d == 2  || d == 3 ) && m == October   && y == 2020)
-            || ((d == 20 || d == 21) && m == September && y == 2021)
-            || ((d == 9  || d == 10) && m == October   && y == 2022)
-            || ((d == 29 || d == 30) && m == September && y == 2023)
-            || ((d == 16 || d == 17) && m == October   && y == 2024)
-            || ((d == 6  || d == 7 ) && m == October   && y == 2025)
-            || ((d == 25 || d == 26) && m == September && y == 2026)
-            || ((d == 15 || d == 16) && m == October   && y == 2027)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2028)
-            || ((d == 23 || d == 24) && m == September && y == 2029)
-            || ((d == 11 || d == 12) && m == October   && y == 2030)
-            || ((d == 1  || d == 2 ) && m == October   && y == 2031)
-            || ((d == 19 || d == 20) && m == September && y == 2032)
-            || ((d == 7  || d == 8 ) && m == October   && y == 2033)
-            || ((d == 27 || d == 28) && m == September && y == 2034)
-            || ((d == 17 || d == 18) && m == October   && y == 2035)
-            || ((d == 5  || d == 6 ) && m == October   && y == 2036)
-            || ((d == 23 || d == 24) && m == September && y == 2037)
-            || ((d == 13 || d == 14) && m == October   && y == 2038)
-            || ((d == 2  || d == 3 ) && m == October   && y == 2039)
-            || ((d == 21 || d == 22) && m == September && y == 2040)
-            || ((d == 9  || d == 10) && m == October   && y == 2041)
-            || ((d == 28 || d == 29) && m == September && y == 2042)
-            || ((d == 18 || d == 19) && m == October   && y == 2043)
-            || ((d == 5  || d == 6 ) && m == October   && y == 2044)
+            Date(18, Sep, 2013), Date(19, Sep, 2013),
+            Date(8, Oct, 2014), Date(9, Oct, 2014),
+            Date(27, Sep, 2015), Date(28, Sep, 2015),
+            Date(16, Oct, 2016), Date(17, Oct, 2016),
+            Date(4, Oct, 2017), Date(5, Oct, 2017),
+            Date(23, Sep, 2018), Date(24, Sep, 2018),
+            Date(13, Oct, 2019), Date(14, Oct, 2019),
+            Date(2, Oct, 2020), Date(3, Oct, 2020),
+            Date(20, Sep, 2021), Date(21, Sep, 2021),
+            Date(9, Oct, 2022), Date(10, Oct, 2022),
+            Date(29, Sep, 2023), Date(30, Sep, 2023),
+            Date(16, Oct, 2024), Date(17, Oct, 2024),
+            Date(6, Oct, 2025), Date(7, Oct, 2025),
+            Date(25, Sep, 2026), Date(26, Sep, 2026),
+            Date(15, Oct, 2027), Date(16, Oct, 2027),
+            Date(4, Oct, 2028), Date(5, Oct, 2028),
+            Date(23, Sep, 2029), Date(24, Sep, 2029),
+            Date(11, Oct, 2030), Date(12, Oct, 2030),
+            Date(1, Oct, 2031), Date(2, Oct, 2031),
+            Date(19, Sep, 2032), Date(20, Sep, 2032),
+            Date(7, Oct, 2033), Date(8, Oct, 2033),
+            Date(27, Sep, 2034), Date(28, Sep, 2034),
+            Date(17, Oct, 2035), Date(18, Oct, 2035),
+            Date(5, Oct, 2036), Date(6, Oct, 2036),
+            Date(23, Sep, 2037), Date(24, Sep, 2037),
+            Date(13, Oct, 2038), Date(14, Oct, 2038),
+            Date(2, Oct, 2039), Date(3, Oct, 2039),
+            Date(21, Sep, 2040), Date(22, Sep, 2040),
+            Date(9, Oct, 2041), Date(10, Oct, 2041),
+            Date(28, Sep, 2042), Date(29, Sep, 2042),
+            Date(18, Oct, 2043), Date(19, Oct, 2043),
+            Date(5, Oct, 2044), Date(6, Oct, 2044),
             //Simchat Tora
-            || ((d == 25 || d == 26) && m == September && y == 2013)
-            || ((d == 15 || d == 16) && m == October   && y == 2014)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2015)
-            || ((d == 23 || d == 24) && m == October   && y == 2016)
-            || ((d == 11 || d == 12) && m == October   && y == 2017)
-            || (((d==30&&m==September)||(d==1&&m==October))&&y== 2018)
-            || ((d == 20 || d == 21) && m == October   && y == 2019)
-            || ((d == 9  || d == 10) && m == October   && y == 2020)
-            || ((d == 27 || d == 28) && m == September && y == 2021)
-            || ((d == 16 || d == 17) && m == October   && y == 2022)
-            || ((d == 6  || d == 7 ) && m == October   && y == 2023)
-            || ((d == 23 || d == 24) && m == October   && y == 2024)
-            || ((d == 13 || d == 14) && m == October   && y == 2025)
-            || ((d == 2  || d == 3 ) && m == October   && y == 2026)
-            || ((d == 22 || d == 23) && m == October   && y == 2027)
-            || ((d == 11 || d == 12) && m == October   && y == 2028)
-            || (((d==30&&m==September)||(d==1&&m==October))&&y== 2029)
-            || ((d == 18 || d == 19) && m == October   && y == 2030)
-            || ((d == 8  || d == 9 ) && m == October   && y == 2031)
-            || ((d == 26 || d == 27) && m == September && y == 2032)
-            || ((d == 14 || d == 15) && m == October   && y == 2033)
-            || ((d == 4  || d == 5 ) && m == October   && y == 2034)
-            || ((d == 24 || d == 25) && m == October   && y == 2035)
-            || ((d == 12 || d == 13) && m == October   && y == 2036)
-            || (((d==30&&m==September)||(d==1&&m==October))&&y== 2037)
-            || ((d == 20 || d == 21) && m == October   && y == 2038)
-            || ((d == 9  || d == 10) && m == October   && y == 2039)
-            || ((d == 28 || d == 29) && m == September && y == 2040)
-            || ((d == 16 || d == 17) && m == October   && y == 2041)
-            || ((d == 5  || d == 6 ) && m == October   && y == 2042)
-            || ((d == 25 || d == 26) && m == October   && y == 2043)
-            || ((d == 12 || d == 13) && m == October   && y == 2044))
-            return false;
+            Date(25, Sep, 2013), Date(26, Sep, 2013),
+            Date(15, Oct, 2014), Date(16, Oct, 2014),
+            Date(4, Oct, 2015), Date(5, Oct, 2015),
+            Date(23, Oct, 2016), Date(24, Oct, 2016),
+            Date(11, Oct, 2017), Date(12, Oct, 2017),
+            Date(30, Sep, 2018), Date(1, Oct, 2018),
+            Date(20, Oct, 2019), Date(21, Oct, 2019),
+            Date(9, Oct, 2020), Date(10, Oct, 2020),
+            Date(27, Sep, 2021), Date(28, Sep, 2021),
+            Date(16, Oct, 2022), Date(17, Oct, 2022),
+            Date(6, Oct, 2023), Date(7, Oct, 2023),
+            Date(23, Oct, 2024), Date(24, Oct, 2024),
+            Date(13, Oct, 2025), Date(14, Oct, 2025),
+            Date(2, Oct, 2026), Date(3, Oct, 2026),
+            Date(22, Oct, 2027), Date(23, Oct, 2027),
+            Date(11, Oct, 2028), Date(12, Oct, 2028),
+            Date(30, Sep, 2029), Date(1, Oct, 2029),
+            Date(18, Oct, 2030), Date(19, Oct, 2030),
+            Date(8, Oct, 2031), Date(9, Oct, 2031),
+            Date(26, Sep, 2032), Date(27, Sep, 2032),
+            Date(14, Oct, 2033), Date(15, Oct, 2033),
+            Date(4, Oct, 2034), Date(5, Oct, 2034),
+            Date(24, Oct, 2035), Date(25, Oct, 2035),
+            Date(12, Oct, 2036), Date(13, Oct, 2036),
+            Date(30, Sep, 2037), Date(1, Oct, 2037),
+            Date(20, Oct, 2038), Date(21, Oct, 2038),
+            Date(9, Oct, 2039), Date(10, Oct, 2039),
+            Date(28, Sep, 2040), Date(29, Sep, 2040),
+            Date(16, Oct, 2041), Date(17, Oct, 2041),
+            Date(5, Oct, 2042), Date(6, Oct, 2042),
+            Date(25, Oct, 2043), Date(26, Oct, 2043),
+            Date(12, Oct, 2044), Date(13, Oct, 2044)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        Weekday w = date.weekday();
 
+        if (isWeekend(w)
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
+            return false;
         return true;
     }
 
@@ -62,8 +62,8 @@ namespace QuantLib {
       private:
         class TelAvivImpl : public Calendar::Impl {
           public:
+            TelAvivImpl() : Calendar::Impl(weekendOf(Friday, Saturday)) {}
             std::string name() const { return "Tel Aviv stock exchange"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
       public:
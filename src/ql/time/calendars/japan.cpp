@@ -29,15 +29,12 @@ namespace QuantLib {
         impl_ = impl;
     }
 
-    bool Japan::Impl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
-
     bool Japan::Impl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
         // equinox calculation
         const Time exact_vernal_equinox_time = 20.69115;
         const Time exact_autumnal_equinox_time = 23.09;
@@ -63,8 +63,8 @@ namespace QuantLib {
       private:
         class Impl : public Calendar::Impl {
           public:
+            Impl() : Calendar::Impl(weekendOf(Saturday, Sunday)) {}
             std::string name() const { return "Japan"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
       public:
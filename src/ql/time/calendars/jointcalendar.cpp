@@ -27,19 +27,21 @@ namespace QuantLib {
     JointCalendar::Impl::Impl(const Calendar& c1,
                               const Calendar& c2,
                               JointCalendarRule r)
-    : rule_(r), calendars_(2) {
+    : Calendar::Impl(0), rule_(r), calendars_(2) {
         calendars_[0] = c1;
         calendars_[1] = c2;
+        joinWeekends();
     }
 
     JointCalendar::Impl::Impl(const Calendar& c1,
                               const Calendar& c2,
                               const Calendar& c3,
                               JointCalendarRule r)
-    : rule_(r), calendars_(3) {
+    : Calendar::Impl(0), rule_(r), calendars_(3) {
         calendars_[0] = c1;
         calendars_[1] = c2;
         calendars_[2] = c3;
+        joinWeekends();
     }
 
     JointCalendar::Impl::Impl(const Calendar& c1,
@@ -47,11 +49,19 @@ namespace QuantLib {
                               const Calendar& c3,
                               const Calendar& c4,
                               JointCalendarRule r)
-    : rule_(r), calendars_(4) {
+    : Calendar::Impl(0), rule_(r), calendars_(4) {
         calendars_[0] = c1;
         calendars_[1] = c2;
         calendars_[2] = c3;
         calendars_[3] = c4;
+        joinWeekends();
+    }
+
+    JointCalendar::Impl::Impl(const std::vector<Calendar>& cv,
+                              JointCalendarRule r)
+    : Calendar::Impl(0), rule_(r), calendars_(cv) {
+        QL_REQUIRE(!calendars_.empty(), "no calendars given");
+        joinWeekends();
     }
 
     std::string JointCalendar::Impl::name() const {
@@ -74,21 +84,19 @@ namespace QuantLib {
         return out.str();
     }
 
-    bool JointCalendar::Impl::isWeekend(Weekday w) const {
+    void JointCalendar::Impl::joinWeekends() {
         std::vector<Calendar>::const_iterator i;
         switch (rule_) {
           case JoinHolidays:
-            for (i=calendars_.begin(); i!=calendars_.end(); ++i) {
-                if (i->isWeekend(w))
-                    return true;
-            }
-            return false;
+            weekendMask_ = 0;
+            for (i=calendars_.begin(); i!=calendars_.end(); ++i)
+                weekendMask_ |= i->weekendMask();
+            break;
           case JoinBusinessDays:
-            for (i=calendars_.begin(); i!=calendars_.end(); ++i) {
-                if (!i->isWeekend(w))
-                    return false;
-            }
-            return true;
+            weekendMask_ = 0x7F;
+            for (i=calendars_.begin(); i!=calendars_.end(); ++i)
+                weekendMask_ &= i->weekendMask();
+            break;
           default:
             QL_FAIL("unknown joint calendar rule");
         }
@@ -114,6 +122,32 @@ namespace QuantLib {
         }
     }
 
+    ext::shared_ptr<const BusinessDayIndex>
+    JointCalendar::Impl::buildRuleIndex() const {
+        std::vector<ext::shared_ptr<const BusinessDayIndex> > indexes;
+        indexes.reserve(calendars_.size());
+        std::vector<Calendar>::const_iterator i;
+        for (i=calendars_.begin(); i!=calendars_.end(); ++i) {
+            if (i->compiled()) {
+                indexes.push_back(i->index());
+            } else {
+                Calendar c = *i;
+                c.compile();
+                indexes.push_back(c.index());
+            }
+        }
+        switch (rule_) {
+          case JoinHolidays:
+            return ext::make_shared<BusinessDayIndex>(
+                                     indexes, BusinessDayIndex::Intersection);
+          case JoinBusinessDays:
+            return ext::make_shared<BusinessDayIndex>(
+                                            indexes, BusinessDayIndex::Union);
+          default:
+            QL_FAIL("unknown joint calendar rule");
+        }
+    }
+
 
     JointCalendar::JointCalendar(const Calendar& c1,
                                  const Calendar& c2,
@@ -139,5 +173,10 @@ namespace QuantLib {
                                       new JointCalendar::Impl(c1,c2,c3,c4,r));
     }
 
-}
+    JointCalendar::JointCalendar(const std::vector<Calendar>& cv,
+                                 JointCalendarRule r) {
+        impl_ = ext::shared_ptr<Calendar::Impl>(
+                                         new JointCalendar::Impl(cv,r));
+    }
 
+}
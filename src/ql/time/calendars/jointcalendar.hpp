@@ -46,6 +46,11 @@ namespace QuantLib {
         business days given by either the union or the intersection
         of the sets of business days of the given calendars.
 
+        Once compiled, the joint calendar takes its index from the
+        compiled indexes of the given calendars, combined a word at a
+        time; looking up a date then costs the same as for a single
+        calendar, regardless of the number of calendars joined.
+
         \ingroup calendars
 
         \test the correctness of the returned results is tested by
@@ -62,10 +67,14 @@ namespace QuantLib {
             Impl(const Calendar&, const Calendar&,
                  const Calendar&, const Calendar&,
                  JointCalendarRule);
+            Impl(const std::vector<Calendar>&, JointCalendarRule);
             std::string name() const;
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
+          protected:
+            ext::shared_ptr<const BusinessDayIndex> buildRuleIndex() const;
           private:
+            // the weekend of the joined calendars, as of construction
+            void joinWeekends();
             JointCalendarRule rule_;
             std::vector<Calendar> calendars_;
         };
@@ -78,6 +87,9 @@ namespace QuantLib {
         JointCalendar(const Calendar&, const Calendar&,
                       const Calendar&, const Calendar&,
                       JointCalendarRule = JoinHolidays);
+        /*! \pre at least one calendar must be given */
+        explicit JointCalendar(const std::vector<Calendar>&,
+                               JointCalendarRule = JoinHolidays);
     };
 
 }
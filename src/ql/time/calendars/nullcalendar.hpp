@@ -39,8 +39,8 @@ namespace QuantLib {
       private:
         class Impl : public Calendar::Impl {
           public:
+            Impl() : Calendar::Impl(0) {}
             std::string name() const { return "Null"; }
-            bool isWeekend(Weekday) const { return false; }
             bool isBusinessDay(const Date&) const { return true; }
         };
       public:
@@ -44,9 +44,10 @@ namespace QuantLib {
 
 
     bool Russia::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
         if (isWeekend(w)
             // New Year's holidays
             || (d >= 1 && d <= 8 && m == January)
@@ -138,10 +139,11 @@ namespace QuantLib {
     }
 
     bool Russia::ExchangeImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
 
         // the exchange was formally established in 2011, so data are only
         // available from 2012 to present
@@ -21,6 +21,7 @@
 #include <ql/time/calendars/saudiarabia.hpp>
 #include <ql/errors.hpp>
 #include <boost/assign/list_of.hpp> // for 'list_of()'
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -34,6 +35,24 @@ namespace QuantLib {
                 (w == Friday || w == Saturday);
         }
 
+        struct EidFollows {
+            bool operator()(const Date& d, const Date& eid) const {
+                return d.serialNumber() + 1 < eid.serialNumber();
+            }
+        };
+
+        // whether d falls from the day before to four days after one of
+        // the given Eid dates, which must be sorted
+        bool isEidHoliday(const Date& d, const std::vector<Date>& eids) {
+            // the last Eid no later than the day after d
+            std::vector<Date>::const_iterator p =
+                std::upper_bound(eids.begin(), eids.end(), d, EidFollows());
+            if (p == eids.begin())
+                return false;
+            --p;
+            return d.serialNumber() <= p->serialNumber() + 4;
+        }
+
         // In 2015 and 2014, the Eid holidays of the Tadawul Exchange
         // have been from Eid-1 to Eid+4
         // Sometimes, slightly longer holidays are observed 
@@ -80,13 +99,7 @@ namespace QuantLib {
                                       (Date(20, July, 2021))
                                       (Date(10, July, 2022));
 
-            for (std::vector<Date>::iterator p = EidAlAdha.begin();
-                                             p != EidAlAdha.end(); ++p) {
-                if (d >= *p -1 && d <= *p + 4) {
-                    return true;
-                }
-            }
-            return false;
+            return isEidHoliday(d, EidAlAdha);
         }
 
         bool isEidAlFitr(Date d) {
@@ -123,13 +136,7 @@ namespace QuantLib {
                                       (Date(26, Feb, 2028))
                                       (Date(14, Feb, 2029));
 
-            for (std::vector<Date>::iterator p = EidAlFitr.begin();
-                                             p != EidAlFitr.end(); ++p) {
-                if (d >= *p -1 && d <= *p + 4) {
-                    return true;
-                }
-            }
-            return false;
+            return isEidHoliday(d, EidAlFitr);
         }
 
     }
@@ -147,14 +154,11 @@ namespace QuantLib {
         }
     }
 
-    bool SaudiArabia::TadawulImpl::isWeekend(Weekday w) const {
-        return w == Friday || w == Saturday;
-    }
-
     bool SaudiArabia::TadawulImpl::isBusinessDay(const Date& date) const {
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
 
         if (isTrueWeekend(date)
             || isEidAlAdha(date)
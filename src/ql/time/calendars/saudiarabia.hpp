@@ -51,8 +51,8 @@ namespace QuantLib {
       private:
         class TadawulImpl : public Calendar::Impl {
           public:
+            TadawulImpl() : Calendar::Impl(weekendOf(Friday, Saturday)) {}
             std::string name() const { return "Tadawul"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
       public:
@@ -23,6 +23,7 @@
 */
 
 #include <ql/time/calendars/southkorea.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -45,15 +46,122 @@ namespace QuantLib {
         }
     }
 
-    bool SouthKorea::SettlementImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
-
     bool SouthKorea::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        static const Date special_holidays[] = {
+            // Lunar New Year
+            Date(21, Jan, 2004), Date(22, Jan, 2004), Date(23, Jan, 2004),
+            Date(8, Feb, 2005), Date(9, Feb, 2005), Date(10, Feb, 2005),
+            Date(28, Jan, 2006), Date(29, Jan, 2006), Date(30, Jan, 2006),
+            Date(19, Feb, 2007),
+            Date(6, Feb, 2008), Date(7, Feb, 2008), Date(8, Feb, 2008),
+            Date(25, Jan, 2009), Date(26, Jan, 2009), Date(27, Jan, 2009),
+            Date(13, Feb, 2010), Date(14, Feb, 2010), Date(15, Feb, 2010),
+            Date(2, Feb, 2011), Date(3, Feb, 2011), Date(4, Feb, 2011),
+            Date(23, Jan, 2012), Date(24, Jan, 2012),
+            Date(11, Feb, 2013),
+            Date(30, Jan, 2014), Date(31, Jan, 2014),
+            Date(18, Feb, 2015), Date(19, Feb, 2015), Date(20, Feb, 2015),
+            Date(7, Feb, 2016), Date(8, Feb, 2016), Date(9, Feb, 2016),
+            Date(10, Feb, 2016),
+            Date(27, Jan, 2017), Date(28, Jan, 2017), Date(29, Jan, 2017),
+            Date(15, Feb, 2018), Date(16, Feb, 2018), Date(17, Feb, 2018),
+            Date(4, Feb, 2019), Date(5, Feb, 2019), Date(6, Feb, 2019),
+            Date(24, Jan, 2020), Date(25, Jan, 2020), Date(26, Jan, 2020),
+            Date(11, Feb, 2021), Date(12, Feb, 2021), Date(13, Feb, 2021),
+            Date(31, Jan, 2022), Date(1, Feb, 2022), Date(2, Feb, 2022),
+            Date(21, Jan, 2023), Date(22, Jan, 2023), Date(23, Jan, 2023),
+            Date(9, Feb, 2024), Date(10, Feb, 2024), Date(11, Feb, 2024),
+            Date(28, Jan, 2025), Date(29, Jan, 2025), Date(30, Jan, 2025),
+            Date(16, Feb, 2026), Date(17, Feb, 2026), Date(18, Feb, 2026),
+            Date(5, Feb, 2027), Date(6, Feb, 2027), Date(7, Feb, 2027),
+            Date(25, Jan, 2028), Date(26, Jan, 2028), Date(27, Jan, 2028),
+            Date(12, Feb, 2029), Date(13, Feb, 2029), Date(14, Feb, 2029),
+            Date(2, Feb, 2030), Date(3, Feb, 2030), Date(4, Feb, 2030),
+            Date(22, Jan, 2031), Date(23, Jan, 2031), Date(24, Jan, 2031),
+            Date(10, Feb, 2032), Date(11, Feb, 2032), Date(12, Feb, 2032),
+            // Election Days
+            Date(15, Apr, 2004), // National Assembly
+            Date(31, May, 2006), // Regional election
+            Date(19, Dec, 2007), // Presidency
+            Date(9, Apr, 2008), // National Assembly
+            Date(2, Jun, 2010), // Local election
+            Date(11, Apr, 2012), // National Assembly
+            Date(19, Dec, 2012), // Presidency
+            Date(4, Jun, 2014), // Local election
+            Date(13, Apr, 2016), // National Assembly
+            // Buddha's birthday
+            Date(26, May, 2004),
+            Date(15, May, 2005),
+            Date(5, May, 2006),
+            Date(24, May, 2007),
+            Date(12, May, 2008),
+            Date(2, May, 2009),
+            Date(21, May, 2010),
+            Date(10, May, 2011),
+            Date(28, May, 2012),
+            Date(17, May, 2013),
+            Date(6, May, 2014),
+            Date(25, May, 2015),
+            Date(14, May, 2016),
+            Date(3, May, 2017),
+            Date(22, May, 2018),
+            Date(12, May, 2019),
+            Date(30, Apr, 2020),
+            Date(19, May, 2021),
+            Date(8, May, 2022),
+            Date(26, May, 2023),
+            Date(15, May, 2024),
+            Date(5, May, 2025),
+            Date(24, May, 2026),
+            Date(13, May, 2027),
+            Date(2, May, 2028),
+            Date(20, May, 2029),
+            Date(9, May, 2030),
+            Date(28, May, 2031),
+            Date(16, May, 2032),
+            // Special holiday: 70 years from Independence Day
+            Date(14, Aug, 2015),
+            // Harvest Moon Day
+            Date(27, Sep, 2004), Date(28, Sep, 2004), Date(29, Sep, 2004),
+            Date(17, Sep, 2005), Date(18, Sep, 2005), Date(19, Sep, 2005),
+            Date(5, Oct, 2006), Date(6, Oct, 2006), Date(7, Oct, 2006),
+            Date(24, Sep, 2007), Date(25, Sep, 2007), Date(26, Sep, 2007),
+            Date(13, Sep, 2008), Date(14, Sep, 2008), Date(15, Sep, 2008),
+            Date(2, Oct, 2009), Date(3, Oct, 2009), Date(4, Oct, 2009),
+            Date(21, Sep, 2010), Date(22, Sep, 2010), Date(23, Sep, 2010),
+            Date(12, Sep, 2011), Date(13, Sep, 2011),
+            Date(1, Oct, 2012),
+            Date(18, Sep, 2013), Date(19, Sep, 2013), Date(20, Sep, 2013),
+            Date(8, Sep, 2014), Date(9, Sep, 2014), Date(10, Sep, 2014),
+            Date(28, Sep, 2015), Date(29, Sep, 2015),
+            Date(14, Sep, 2016), Date(15, Sep, 2016), Date(16, Sep, 2016),
+            Date(3, Oct, 2017), Date(4, Oct, 2017), Date(5, Oct, 2017),
+            Date(23, Sep, 2018), Date(24, Sep, 2018), Date(25, Sep, 2018),
+            Date(12, Sep, 2019), Date(13, Sep, 2019), Date(14, Sep, 2019),
+            Date(30, Sep, 2020), Date(1, Oct, 2020), Date(2, Oct, 2020),
+            Date(20, Sep, 2021), Date(21, Sep, 2021), Date(22, Sep, 2021),
+            Date(9, Sep, 2022), Date(10, Sep, 2022), Date(11, Sep, 2022),
+            Date(28, Sep, 2023), Date(29, Sep, 2023), Date(30, Sep, 2023),
+            Date(16, Sep, 2024), Date(17, Sep, 2024), Date(18, Sep, 2024),
+            Date(5, Oct, 2025), Date(6, Oct, 2025), Date(7, Oct, 2025),
+            Date(24, Sep, 2026), Date(25, Sep, 2026), Date(26, Sep, 2026),
+            Date(14, Sep, 2027), Date(15, Sep, 2027), Date(16, Sep, 2027),
+            Date(2, Oct, 2028), Date(3, Oct, 2028), Date(4, Oct, 2028),
+            Date(21, Sep, 2029), Date(22, Sep, 2029), Date(23, Sep, 2029),
+            Date(11, Sep, 2030), Date(12, Sep, 2030), Date(13, Sep, 2030),
+            Date(30, Sep, 2031), Date(1, Oct, 2031), Date(2, Oct, 2031),
+            Date(18, Sep, 2032), Date(19, Sep, 2032), Date(20, Sep, 2032)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
 
         if (isWeekend(w)
             // New Year's Day
@@ -76,120 +184,11 @@ namespace QuantLib {
             || (d == 3 && m == October)
             // Christmas Day
             || (d == 25 && m == December)
-
-            // Lunar New Year
-            || ((d == 21 || d == 22 || d == 23) && m == January  && y == 2004)
-            || ((d ==  8 || d ==  9 || d == 10) && m == February && y == 2005)
-            || ((d == 28 || d == 29 || d == 30) && m == January  && y == 2006)
-            || ( d == 19                        && m == February && y == 2007)
-            || ((d ==  6 || d ==  7 || d ==  8) && m == February && y == 2008)
-            || ((d == 25 || d == 26 || d == 27) && m == January  && y == 2009)
-            || ((d == 13 || d == 14 || d == 15) && m == February && y == 2010)
-            || ((d ==  2 || d ==  3 || d ==  4) && m == February && y == 2011)
-            || ((d == 23 || d == 24)            && m == January  && y == 2012)
-            || ( d == 11                        && m == February && y == 2013)
-            || ((d == 30 || d == 31)            && m == January  && y == 2014)
-            || ((d == 18 || d == 19 || d == 20) && m == February && y == 2015)
-            || ((d >=  7 && d <= 10)            && m == February && y == 2016)
-            || ((d == 27 || d == 28 || d == 29) && m == January  && y == 2017)
-            || ((d == 15 || d == 16 || d == 17) && m == February && y == 2018)
-            || ((d ==  4 || d ==  5 || d ==  6) && m == February && y == 2019)
-            || ((d == 24 || d == 25 || d == 26) && m == January  && y == 2020)
-            || ((d == 11 || d == 12 || d == 13) && m == February && y == 2021)
-            || (((d == 31 && m == January) || ((d == 1 || d == 2)
-                                              && m == February)) && y == 2022)
-            || ((d == 21 || d == 22 || d == 23) && m == January  && y == 2023)
-            || ((d ==  9 || d == 10 || d == 11) && m == February && y == 2024)
-            || ((d == 28 || d == 29 || d == 30) && m == January  && y == 2025)
-            || ((d == 16 || d == 17 || d == 18) && m == February && y == 2026)
-            || ((d ==  5 || d ==  6 || d ==  7) && m == February && y == 2027)
-            || ((d == 25 || d == 26 || d == 27) && m == January  && y == 2028)
-            || ((d == 12 || d == 13 || d == 14) && m == February && y == 2029)
-            || ((d ==  2 || d ==  3 || d ==  4) && m == February && y == 2030)
-            || ((d == 22 || d == 23 || d == 24) && m == January  && y == 2031)
-            || ((d == 10 || d == 11 || d == 12) && m == February && y == 2032)
-
-            // Election Days
-            || (d == 15 && m == April    && y == 2004) // National Assembly
-            || (d == 31 && m == May      && y == 2006) // Regional election
-            || (d == 19 && m == December && y == 2007) // Presidency
-            || (d ==  9 && m == April    && y == 2008) // National Assembly
-            || (d ==  2 && m == June     && y == 2010) // Local election
-            || (d == 11 && m == April    && y == 2012) // National Assembly
-            || (d == 19 && m == December && y == 2012) // Presidency
-            || (d ==  4 && m == June     && y == 2014) // Local election
-            || (d == 13 && m == April    && y == 2016) // National Assembly
-            // Buddha's birthday
-            || (d == 26 && m == May   && y == 2004)
-            || (d == 15 && m == May   && y == 2005)
-            || (d ==  5 && m == May   && y == 2006)
-            || (d == 24 && m == May   && y == 2007)
-            || (d == 12 && m == May   && y == 2008)
-            || (d ==  2 && m == May   && y == 2009)
-            || (d == 21 && m == May   && y == 2010)
-            || (d == 10 && m == May   && y == 2011)
-            || (d == 28 && m == May   && y == 2012)
-            || (d == 17 && m == May   && y == 2013)
-            || (d ==  6 && m == May   && y == 2014)
-            || (d == 25 && m == May   && y == 2015)
-            || (d == 14 && m == May   && y == 2016)
-            || (d ==  3 && m == May   && y == 2017)
-            || (d == 22 && m == May   && y == 2018)
-            || (d == 12 && m == May   && y == 2019)
-            || (d == 30 && m == April && y == 2020)
-            || (d == 19 && m == May   && y == 2021)
-            || (d ==  8 && m == May   && y == 2022)
-            || (d == 26 && m == May   && y == 2023)
-            || (d == 15 && m == May   && y == 2024)
-            || (d ==  5 && m == May   && y == 2025)
-            || (d == 24 && m == May   && y == 2026)
-            || (d == 13 && m == May   && y == 2027)
-            || (d ==  2 && m == May   && y == 2028)
-            || (d == 20 && m == May   && y == 2029)
-            || (d ==  9 && m == May   && y == 2030)
-            || (d == 28 && m == May   && y == 2031)
-            || (d == 16 && m == May   && y == 2032)
-
-            // Special holiday: 70 years from Independence Day
-            || (d == 14 && m == August && y == 2015)
-
-            // Harvest Moon Day
-            || ((d == 27 || d == 28 || d == 29) && m == September && y == 2004)
-            || ((d == 17 || d == 18 || d == 19) && m == September && y == 2005)
-            || ((d ==  5 || d ==  6 || d ==  7) && m == October   && y == 2006)
-            || ((d == 24 || d == 25 || d == 26) && m == September && y == 2007)
-            || ((d == 13 || d == 14 || d == 15) && m == September && y == 2008)
-            || ((d ==  2 || d ==  3 || d ==  4) && m == October   && y == 2009)
-            || ((d == 21 || d == 22 || d == 23) && m == September && y == 2010)
-            || ((d == 12 || d == 13)            && m == September && y == 2011)
-            || ((d == 1)                        && m == October   && y == 2012)
-            || ((d == 18 || d == 19 || d == 20) && m == September && y == 2013)
-            || ((d ==  8 || d ==  9 || d == 10) && m == September && y == 2014)
-            || ((d == 28 || d == 29)            && m == September && y == 2015)
-            || ((d == 14 || d == 15 || d == 16) && m == September && y == 2016)
-            || ((d ==  3 || d ==  4 || d ==  5) && m == October   && y == 2017)
-            || ((d == 23 || d == 24 || d == 25) && m == September && y == 2018)
-            || ((d == 12 || d == 13 || d == 14) && m == September && y == 2019)
-            || (((d == 30 && m == September) || ((d == 1 || d == 2) 
-                                                && m == October)) && y == 2020)
-            || ((d == 20 || d == 21 || d == 22) && m == September && y == 2021)
-            || ((d ==  9 || d == 10 || d == 11) && m == September && y == 2022)
-            || ((d == 28 || d == 29 || d == 30) && m == September && y == 2023)
-            || ((d == 16 || d == 17 || d == 18) && m == September && y == 2024)
-            || ((d ==  5 || d ==  6 || d ==  7) && m == October   && y == 2025)
-            || ((d == 24 || d == 25 || d == 26) && m == September && y == 2026)
-            || ((d == 14 || d == 15 || d == 16) && m == September && y == 2027)
-            || ((d ==  2 || d ==  3 || d ==  4) && m == October   && y == 2028)
-            || ((d == 21 || d == 22 || d == 23) && m == September && y == 2029)
-            || ((d == 11 || d == 12 || d == 13) && m == September && y == 2030)
-            || (((d == 30 && m == September) || ((d == 1 || d == 2)
-                                                && m == October)) && y == 2031)
-            || ((d == 18 || d == 19 || d == 20) && m == September && y == 2032)
             // Hangul Proclamation of Korea
             || (d == 9 && m == October && y >= 2013)
-            )
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
             return false;
-
         return true;
     }
 
@@ -198,10 +197,11 @@ namespace QuantLib {
         if ( !SettlementImpl::isBusinessDay(date) )
             return false;
 
-        Day d = date.dayOfMonth();
-        Weekday w = date.weekday();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Day d = fields.dayOfMonth;
+        Weekday w = fields.weekday;
+        Month m = fields.month;
+        Year y = fields.year;
 
         if (// Year-end closing
             ((((d == 29 || d == 30) && w == Friday) || d == 31) 
@@ -77,8 +77,8 @@ namespace QuantLib {
       private:
         class SettlementImpl : public Calendar::Impl {
           public:
+            SettlementImpl() : Calendar::Impl(weekendOf(Saturday, Sunday)) {}
             std::string name() const { return "South-Korean settlement"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
         class KrxImpl : public SettlementImpl {
@@ -19,6 +19,7 @@
 */
 
 #include <ql/time/calendars/taiwan.hpp>
+#include <ql/time/holidayrule.hpp>
 
 namespace QuantLib {
 
@@ -28,320 +29,275 @@ namespace QuantLib {
         impl_ = impl;
     }
 
-    bool Taiwan::TsecImpl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
-
     bool Taiwan::TsecImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        static const Date special_holidays[] = {
+            // 2002: Dragon Boat Festival and Moon Festival fall on Saturday
+            // Chinese Lunar New Year
+            Date(9, Feb, 2002), Date(10, Feb, 2002), Date(11, Feb, 2002),
+            Date(12, Feb, 2002), Date(13, Feb, 2002), Date(14, Feb, 2002),
+            Date(15, Feb, 2002), Date(16, Feb, 2002), Date(17, Feb, 2002),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2002),
 
-        if (isWeekend(w)
-            // New Year's Day
-            || (d == 1 && m == January)
-            // Peace Memorial Day
-            || (d == 28 && m == February)
-            // Labor Day
-            || (d == 1 && m == May)
-            // Double Tenth
-            || (d == 10 && m == October)
-            )
-            return false;
+            // 2003: Tomb Sweeping Day falls on Saturday
+            // Chinese Lunar New Year
+            Date(31, Jan, 2003), Date(1, Feb, 2003), Date(2, Feb, 2003),
+            Date(3, Feb, 2003), Date(4, Feb, 2003), Date(5, Feb, 2003),
+            // Dragon Boat Festival
+            Date(4, Jun, 2003),
+            // Moon Festival
+            Date(11, Sep, 2003),
 
-        if (y == 2002) {
-            // Dragon Boat Festival and Moon Festival fall on Saturday
-            if (// Chinese Lunar New Year
-                (d >= 9 && d <= 17 && m == February)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                )
-                return false;
-        }
+            // 2004: Tomb Sweeping Day falls on Sunday
+            // Chinese Lunar New Year
+            Date(21, Jan, 2004), Date(22, Jan, 2004), Date(23, Jan, 2004),
+            Date(24, Jan, 2004), Date(25, Jan, 2004), Date(26, Jan, 2004),
+            // Dragon Boat Festival
+            Date(22, Jun, 2004),
+            // Moon Festival
+            Date(28, Sep, 2004),
 
-        if (y == 2003) {
-            // Tomb Sweeping Day falls on Saturday
-            if (// Chinese Lunar New Year
-                ((d >= 31 && m == January) || (d <= 5 && m == February))
-                // Dragon Boat Festival
-                || (d == 4 && m == June)
-                // Moon Festival
-                || (d == 11 && m == September)
-                )
-                return false;
-        }
+            // 2005: Dragon Boat and Moon Festival fall on Saturday or Sunday
+            // Chinese Lunar New Year
+            Date(6, Feb, 2005), Date(7, Feb, 2005), Date(8, Feb, 2005),
+            Date(9, Feb, 2005), Date(10, Feb, 2005), Date(11, Feb, 2005),
+            Date(12, Feb, 2005), Date(13, Feb, 2005),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2005),
+            // make up for Labor Day, not seen in other years
+            Date(2, May, 2005),
 
-        if (y == 2004) {
-            // Tomb Sweeping Day falls on Sunday
-            if (// Chinese Lunar New Year
-                (d >= 21 && d <= 26 && m == January)
-                // Dragon Boat Festival
-                || (d == 22 && m == June)
-                // Moon Festival
-                || (d == 28 && m == September)
-                )
-                return false;
-        }
+            // 2006: Dragon Boat and Moon Festival fall on Saturday or Sunday
+            // Chinese Lunar New Year
+            Date(28, Jan, 2006), Date(29, Jan, 2006), Date(30, Jan, 2006),
+            Date(31, Jan, 2006), Date(1, Feb, 2006), Date(2, Feb, 2006),
+            Date(3, Feb, 2006), Date(4, Feb, 2006), Date(5, Feb, 2006),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2006),
+            // Dragon Boat Festival
+            Date(31, May, 2006),
+            // Moon Festival
+            Date(6, Oct, 2006),
 
-        if (y == 2005) {
-            // Dragon Boat and Moon Festival fall on Saturday or Sunday
-            if (// Chinese Lunar New Year
-                (d >= 6 && d <= 13 && m == February)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // make up for Labor Day, not seen in other years
-                || (d == 2 && m == May)
-                )
-                return false;
-        }
+            // Chinese Lunar New Year
+            Date(17, Feb, 2007), Date(18, Feb, 2007), Date(19, Feb, 2007),
+            Date(20, Feb, 2007), Date(21, Feb, 2007), Date(22, Feb, 2007),
+            Date(23, Feb, 2007), Date(24, Feb, 2007), Date(25, Feb, 2007),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2007),
+            // adjusted holidays
+            Date(6, Apr, 2007),
+            Date(18, Jun, 2007),
+            // Dragon Boat Festival
+            Date(19, Jun, 2007),
+            // adjusted holiday
+            Date(24, Sep, 2007),
+            // Moon Festival
+            Date(25, Sep, 2007),
 
-        if (y == 2006) {
-            // Dragon Boat and Moon Festival fall on Saturday or Sunday
-            if (// Chinese Lunar New Year
-                ((d >= 28 && m == January) || (d <= 5 && m == February))
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Dragon Boat Festival
-                || (d == 31 && m == May)
-                // Moon Festival
-                || (d == 6 && m == October)
-                )
-                return false;
-        }
+            // Chinese Lunar New Year
+            Date(4, Feb, 2008), Date(5, Feb, 2008), Date(6, Feb, 2008),
+            Date(7, Feb, 2008), Date(8, Feb, 2008), Date(9, Feb, 2008),
+            Date(10, Feb, 2008), Date(11, Feb, 2008),
+            // Tomb Sweeping Day
+            Date(4, Apr, 2008),
 
-        if (y == 2007) {
-            if (// Chinese Lunar New Year
-                (d >= 17 && d <= 25 && m == February)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // adjusted holidays
-                || (d == 6 && m == April)
-                || (d == 18 && m == June)
-                // Dragon Boat Festival
-                || (d == 19 && m == June)
-                // adjusted holiday
-                || (d == 24 && m == September)
-                // Moon Festival
-                || (d == 25 && m == September)
-                )
-                return false;
-        }
+            // Public holiday
+            Date(2, Jan, 2009),
+            // Chinese Lunar New Year
+            Date(24, Jan, 2009), Date(25, Jan, 2009), Date(26, Jan, 2009),
+            Date(27, Jan, 2009), Date(28, Jan, 2009), Date(29, Jan, 2009),
+            Date(30, Jan, 2009), Date(31, Jan, 2009),
+            // Tomb Sweeping Day
+            Date(4, Apr, 2009),
+            // Dragon Boat Festival
+            Date(28, May, 2009), Date(29, May, 2009),
+            // Moon Festival
+            Date(3, Oct, 2009),
 
-        if (y == 2008) {
-            if (// Chinese Lunar New Year
-                (d >= 4 && d <= 11 && m == February)
-                // Tomb Sweeping Day
-                || (d == 4 && m == April)
-                )
-                return false;
-        }
+            // Chinese Lunar New Year
+            Date(13, Jan, 2010), Date(14, Jan, 2010), Date(15, Jan, 2010),
+            Date(16, Jan, 2010), Date(17, Jan, 2010), Date(18, Jan, 2010),
+            Date(19, Jan, 2010), Date(20, Jan, 2010), Date(21, Jan, 2010),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2010),
+            // Dragon Boat Festival
+            Date(16, May, 2010),
+            // Moon Festival
+            Date(22, Sep, 2010),
 
-        if (y == 2009) {
-            if (// Public holiday
-                (d == 2 && m == January)
-                // Chinese Lunar New Year
-                || (d >= 24 && m == January)
-                // Tomb Sweeping Day
-                || (d == 4 && m == April)
-                // Dragon Boat Festival
-                || ((d == 28 || d == 29) && m == May)
-                // Moon Festival
-                || (d == 3 && m == October)
-                )
-                return false;
-        }
+            // Spring Festival
+            Date(2, Feb, 2011), Date(3, Feb, 2011), Date(4, Feb, 2011),
+            Date(5, Feb, 2011), Date(6, Feb, 2011), Date(7, Feb, 2011),
+            // Children's Day
+            Date(4, Apr, 2011),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2011),
+            // Labour Day
+            Date(2, May, 2011),
+            // Dragon Boat Festival
+            Date(6, Jun, 2011),
+            // Mid-Autumn Festival
+            Date(12, Sep, 2011),
 
-        if (y == 2010) {
-            if (// Chinese Lunar New Year
-                   (d >= 13 && d <= 21 && m == January)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Dragon Boat Festival
-                || (d == 16 && m == May)
-                // Moon Festival
-                || (d == 22 && m == September)
-                )
-                return false;
-        }
+            // Spring Festival
+            Date(23, Jan, 2012), Date(24, Jan, 2012), Date(25, Jan, 2012),
+            Date(26, Jan, 2012), Date(27, Jan, 2012),
+            // Peace Memorial Day
+            Date(27, Feb, 2012),
+            // Children's Day
+            // Tomb Sweeping Day
+            Date(4, Apr, 2012),
+            // Labour Day
+            Date(1, May, 2012),
+            // Dragon Boat Festival
+            Date(23, Jun, 2012),
+            // Mid-Autumn Festival
+            Date(30, Sep, 2012),
+            // Memorial Day:
+            // Founding of the Republic of China
+            Date(31, Dec, 2012),
+
+            // Spring Festival
+            Date(10, Feb, 2013), Date(11, Feb, 2013), Date(12, Feb, 2013),
+            Date(13, Feb, 2013), Date(14, Feb, 2013), Date(15, Feb, 2013),
+            // Children's Day
+            Date(4, Apr, 2013),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2013),
+            // Labour Day
+            Date(1, May, 2013),
+            // Dragon Boat Festival
+            Date(12, Jun, 2013),
+            // Mid-Autumn Festival
+            Date(19, Sep, 2013), Date(20, Sep, 2013),
 
-        if (y == 2011) {
-            if (// Spring Festival
-                   (d >= 2 && d <= 7 && m == February)
-                // Children's Day
-                || (d == 4 && m == April)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Labour Day
-                || (d == 2 && m == May)
-                // Dragon Boat Festival
-                || (d == 6 && m == June)
-                // Mid-Autumn Festival
-                || (d == 12 && m == September)
-                )
-                return false;
-        }
+            // Lunar New Year
+            Date(28, Jan, 2014), Date(29, Jan, 2014), Date(30, Jan, 2014),
+            // Spring Festival
+            Date(31, Jan, 2014), Date(1, Feb, 2014), Date(2, Feb, 2014),
+            Date(3, Feb, 2014), Date(4, Feb, 2014),
+            // Children's Day
+            Date(4, Apr, 2014),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2014),
+            // Dragon Boat Festival
+            Date(2, Jun, 2014),
+            // Mid-Autumn Festival
+            Date(8, Sep, 2014),
 
-        if (y == 2012) {
-            if (// Spring Festival
-                (d >= 23 && d <= 27 && m == January)
-                // Peace Memorial Day
-                || (d == 27 && m == February)
-                // Children's Day
-                // Tomb Sweeping Day
-                || (d == 4 && m == April)
-                // Labour Day
-                || (d == 1 && m == May)
-                // Dragon Boat Festival
-                || (d == 23 && m == June)
-                // Mid-Autumn Festival
-                || (d == 30 && m == September)
-                // Memorial Day:
-                // Founding of the Republic of China
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
+            // adjusted holidays
+            Date(2, Jan, 2015),
+            // Lunar New Year
+            Date(18, Feb, 2015), Date(19, Feb, 2015), Date(20, Feb, 2015),
+            Date(21, Feb, 2015), Date(22, Feb, 2015), Date(23, Feb, 2015),
+            // adjusted holidays
+            Date(27, Feb, 2015),
+            // adjusted holidays
+            Date(3, Apr, 2015),
+            // adjusted holidays
+            Date(6, Apr, 2015),
+            // adjusted holidays
+            Date(19, Jun, 2015),
+            // adjusted holidays
+            Date(28, Sep, 2015),
+            // adjusted holidays
+            Date(9, Oct, 2015),
 
-        if (y == 2013) {
-            if (// Spring Festival
-                (d >= 10 && d <= 15 && m == February)
-                // Children's Day
-                || (d == 4 && m == April)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Labour Day
-                || (d == 1 && m == May)
-                // Dragon Boat Festival
-                || (d == 12 && m == June)
-                // Mid-Autumn Festival
-                || (d >= 19 && d <= 20 && m == September)
-                )
-                return false;
-        }
+            // Lunar New Year
+            Date(8, Feb, 2016), Date(9, Feb, 2016), Date(10, Feb, 2016),
+            Date(11, Feb, 2016), Date(12, Feb, 2016),
+            // adjusted holidays
+            Date(29, Feb, 2016),
+            // Children's Day
+            Date(4, Apr, 2016),
+            // adjusted holidays
+            Date(5, Apr, 2016),
+            // adjusted holidays
+            Date(2, May, 2016),
+            // Dragon Boat Festival
+            Date(9, Jun, 2016),
+            // adjusted holidays
+            Date(10, Jun, 2016),
+            // Mid-Autumn Festival
+            Date(15, Sep, 2016),
+            // adjusted holidays
+            Date(16, Sep, 2016),
 
-        if (y == 2014) {
-            if (// Lunar New Year
-                (d >= 28 && d <= 30 && m == January)
-                // Spring Festival
-                || ((d == 31 && m == January) || (d <= 4 && m == February))
-                // Children's Day
-                || (d == 4 && m == April)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Dragon Boat Festival
-                || (d == 2 && m == June)
-                // Mid-Autumn Festival
-                || (d == 8 && m == September)
-                )
-                return false;
-        }
+            // adjusted holidays
+            Date(2, Jan, 2017),
+            // Lunar New Year
+            Date(27, Jan, 2017), Date(28, Jan, 2017), Date(29, Jan, 2017),
+            Date(30, Jan, 2017), Date(31, Jan, 2017), Date(1, Feb, 2017),
+            // adjusted holidays
+            Date(27, Feb, 2017),
+            // adjusted holidays
+            Date(3, Apr, 2017),
+            // Children's Day
+            Date(4, Apr, 2017),
+            // adjusted holidays
+            Date(29, May, 2017),
+            // Dragon Boat Festival
+            Date(30, May, 2017),
+            // Mid-Autumn Festival
+            Date(4, Oct, 2017),
+            // adjusted holidays
+            Date(9, Oct, 2017),
 
-        if (y == 2015) {
-            if (// adjusted holidays
-                (d == 2 && m == January)
-                // Lunar New Year
-                || (d >= 18 && d <= 23 && m == February)
-                // adjusted holidays
-                || (d == 27 && m == February)
-                // adjusted holidays
-                || (d == 3 && m == April)
-                // adjusted holidays
-                || (d == 6 && m == April)
-                // adjusted holidays
-                || (d == 19 && m == June)
-                // adjusted holidays
-                || (d == 28 && m == September)
-                // adjusted holidays
-                || (d == 9 && m == October)
-                )
-                return false;
-        }
-        
-        if (y == 2016) {
-            if (// Lunar New Year
-                (d >= 8 && d <= 12 && m == February)
-                // adjusted holidays
-                || (d == 29 && m == February)
-                // Children's Day
-                || (d == 4 && m == April)
-                // adjusted holidays
-                || (d == 5 && m == April)
-                // adjusted holidays
-                || (d == 2 && m == May)
-                // Dragon Boat Festival
-                || (d == 9 && m == June)
-                // adjusted holidays
-                || (d == 10 && m == June)
-                // Mid-Autumn Festival
-                || (d == 15 && m == September)
-                // adjusted holidays
-                || (d == 16 && m == September)
-                )
-                return false;
-        }
+            // Lunar New Year
+            Date(15, Feb, 2018), Date(16, Feb, 2018), Date(17, Feb, 2018),
+            Date(18, Feb, 2018), Date(19, Feb, 2018), Date(20, Feb, 2018),
+            // Children's Day
+            Date(4, Apr, 2018),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2018),
+            // adjusted holidays
+            Date(6, Apr, 2018),
+            // Dragon Boat Festival
+            Date(18, Jun, 2018),
+            // Mid-Autumn Festival
+            Date(24, Sep, 2018),
+            // adjusted holidays
+            Date(31, Dec, 2018),
 
-        if (y == 2017) {
-            if (// adjusted holidays
-                (d == 2 && m == January)
-                // Lunar New Year
-                || ((d >= 27 && m == January) || (d == 1 && m == February))
-                // adjusted holidays
-                || (d == 27 && m == February)
-                // adjusted holidays
-                || (d == 3 && m == April)
-                // Children's Day
-                || (d == 4 && m == April)
-                // adjusted holidays
-                || (d == 29 && m == May)
-                // Dragon Boat Festival
-                || (d == 30 && m == May)
-                // Mid-Autumn Festival
-                || (d == 4 && m == October)
-                // adjusted holidays
-                || (d == 9 && m == October)
-                )
-                return false;
-        }
-    
-        if (y == 2018) {
-            if (// Lunar New Year
-                (d >= 15 && d <= 20 && m == February)
-                // Children's Day
-                || (d == 4 && m == April)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // adjusted holidays
-                || (d == 6 && m == April)
-                // Dragon Boat Festival
-                || (d == 18 && m == June)
-                // Mid-Autumn Festival
-                || (d == 24 && m == September)
-                // adjusted holidays
-                || (d == 31 && m == December)
-                )
-                return false;
-        }
+            // Lunar New Year
+            Date(4, Feb, 2019), Date(5, Feb, 2019), Date(6, Feb, 2019),
+            Date(7, Feb, 2019), Date(8, Feb, 2019),
+            // adjusted holidays
+            Date(1, Mar, 2019),
+            // Children's Day
+            Date(4, Apr, 2019),
+            // Tomb Sweeping Day
+            Date(5, Apr, 2019),
+            // Dragon Boat Festival
+            Date(7, Jun, 2019),
+            // Mid-Autumn Festival
+            Date(13, Sep, 2019),
+            // adjusted holidays
+            Date(11, Oct, 2019)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
 
-        if (y == 2019) {
-            if (// Lunar New Year
-                (d >= 4 && d <= 8 && m == February)
-                // adjusted holidays
-                || (d == 1 && m == March)
-                // Children's Day
-                || (d == 4 && m == April)
-                // Tomb Sweeping Day
-                || (d == 5 && m == April)
-                // Dragon Boat Festival
-                || (d == 7 && m == June)
-                // Mid-Autumn Festival
-                || (d == 13 && m == September)
-                // adjusted holidays
-                || (d == 11 && m == October)
-                )
-                return false;
-        }
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
 
+        if (isWeekend(w)
+            // New Year's Day
+            || (d == 1 && m == January)
+            // Peace Memorial Day
+            || (d == 28 && m == February)
+            // Labor Day
+            || (d == 1 && m == May)
+            // Double Tenth
+            || (d == 10 && m == October)
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
+            return false;
         return true;
     }
 
@@ -56,8 +56,8 @@ namespace QuantLib {
       private:
         class TsecImpl : public Calendar::Impl {
           public:
+            TsecImpl() : Calendar::Impl(weekendOf(Saturday, Sunday)) {}
             std::string name() const { return "Taiwan stock exchange"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
       public:
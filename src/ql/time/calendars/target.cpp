@@ -18,6 +18,7 @@
 */
 
 #include <ql/time/calendars/target.hpp>
+#include <ql/time/holidayrule.hpp>
 
 namespace QuantLib {
 
@@ -28,29 +29,28 @@ namespace QuantLib {
     }
 
     bool TARGET::Impl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day
-            || (d == 1  && m == January)
+            HolidayRule::fixed(January, 1),
             // Good Friday
-            || (dd == em-3 && y >= 2000)
+            HolidayRule::easter(-3).since(2000),
             // Easter Monday
-            || (dd == em && y >= 2000)
+            HolidayRule::easter(0).since(2000),
             // Labour Day
-            || (d == 1  && m == May && y >= 2000)
+            HolidayRule::fixed(May, 1).since(2000),
             // Christmas
-            || (d == 25 && m == December)
+            HolidayRule::fixed(December, 25),
             // Day of Goodwill
-            || (d == 26 && m == December && y >= 2000)
+            HolidayRule::fixed(December, 26).since(2000),
             // December 31st, 1998, 1999, and 2001 only
-            || (d == 31 && m == December &&
-                (y == 1998 || y == 1999 || y == 2001)))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 31).only(1998),
+            HolidayRule::fixed(December, 31).only(1999),
+            HolidayRule::fixed(December, 31).only(2001)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
 }
@@ -20,6 +20,7 @@
 */
 
 #include <ql/time/calendars/turkey.hpp>
+#include <ql/time/holidayrule.hpp>
 
 namespace QuantLib {
 
@@ -29,249 +30,232 @@ namespace QuantLib {
         impl_ = impl;
     }
 
-    bool Turkey::Impl::isWeekend(Weekday w) const {
-        return w == Saturday || w == Sunday;
-    }
-
     bool Turkey::Impl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-
-        if (isWeekend(w)
-            // New Year's Day
-            || (d == 1 && m == January)
-            // 23 nisan / National Holiday
-            || (d == 23 && m == April)
-            // 1 may/ National Holiday
-            || (d == 1 && m == May)
-            // 19 may/ National Holiday
-            || (d == 19 && m == May)
-            // 30 aug/ National Holiday
-            || (d == 30 && m == August)
-            ///29 ekim  National Holiday
-            || (d == 29 && m == October))
-            return false;
-
-        // Local Holidays
-        if (y == 2004) {
+        static const Date special_holidays[] = {
             // Kurban
-            if ((m == February && d <= 4)
+            Date(1, Feb, 2004), Date(2, Feb, 2004), Date(3, Feb, 2004),
+            Date(4, Feb, 2004),
             // Ramadan
-                || (m == November && d >= 14 && d <= 16))
-                return false;
-        } else if (y == 2005) {
+            Date(14, Nov, 2004), Date(15, Nov, 2004), Date(16, Nov, 2004),
+
             // Kurban
-            if ((m == January && d >= 19 && d <= 21)
+            Date(19, Jan, 2005), Date(20, Jan, 2005), Date(21, Jan, 2005),
             // Ramadan
-                || (m == November && d >= 2 && d <= 5))
-                return false;
-        } else if (y == 2006) {
+            Date(2, Nov, 2005), Date(3, Nov, 2005), Date(4, Nov, 2005),
+            Date(5, Nov, 2005),
+
             // Kurban
-            if ((m == January && d >= 10 && d <= 13)
+            Date(10, Jan, 2006), Date(11, Jan, 2006), Date(12, Jan, 2006),
+            Date(13, Jan, 2006),
             // Ramadan
-                || (m == October && d >= 23 && d <= 25)
+            Date(23, Oct, 2006), Date(24, Oct, 2006), Date(25, Oct, 2006),
             // Kurban
-                || (m == December && d == 31))
-                return false;
-        } else if (y == 2007) {
+            Date(31, Dec, 2006),
+
             // Kurban
-            if ((m == January && d <= 3)
+            Date(1, Jan, 2007), Date(2, Jan, 2007), Date(3, Jan, 2007),
             // Ramadan
-                || (m == October && d >= 12 && d <= 14)
+            Date(12, Oct, 2007), Date(13, Oct, 2007), Date(14, Oct, 2007),
             // Kurban
-                || (m == December && d >= 20 && d <= 23))
-                return false;
-        } else if (y == 2008) {
+            Date(20, Dec, 2007), Date(21, Dec, 2007), Date(22, Dec, 2007),
+            Date(23, Dec, 2007),
+
             // Ramadan
-            if ((m == September && d == 30)
-                || (m == October && d <= 2)
+            Date(30, Sep, 2008),
+            Date(1, Oct, 2008), Date(2, Oct, 2008),
             // Kurban
-                || (m == December && d >= 8 && d <= 11))
-                return false;
-        } else if (y == 2009) {
+            Date(8, Dec, 2008), Date(9, Dec, 2008), Date(10, Dec, 2008),
+            Date(11, Dec, 2008),
+
             // Ramadan
-            if ((m == September && d >= 20 && d <= 22)
+            Date(20, Sep, 2009), Date(21, Sep, 2009), Date(22, Sep, 2009),
             // Kurban
-                || (m == November && d >= 27 && d <= 30))
-                return false;
-        } else if (y == 2010) {
+            Date(27, Nov, 2009), Date(28, Nov, 2009), Date(29, Nov, 2009),
+            Date(30, Nov, 2009),
+
             // Ramadan
-            if ((m == September && d >= 9 && d <= 11)
+            Date(9, Sep, 2010), Date(10, Sep, 2010), Date(11, Sep, 2010),
             // Kurban
-                || (m == November && d >= 16 && d <= 19))
-                return false;
-        } else if (y == 2011) {
+            Date(16, Nov, 2010), Date(17, Nov, 2010), Date(18, Nov, 2010),
+            Date(19, Nov, 2010),
+
             // not clear from borsainstanbul.com
-            if ((m == October && d == 1)
-                || (m == November && d >= 9 && d <= 13))
-                return false;
-        } else if (y == 2012) {
+            Date(1, Oct, 2011),
+            Date(9, Nov, 2011), Date(10, Nov, 2011), Date(11, Nov, 2011),
+            Date(12, Nov, 2011), Date(13, Nov, 2011),
+
             // Ramadan
-            if ((m == August && d >= 18 && d <= 21)
+            Date(18, Aug, 2012), Date(19, Aug, 2012), Date(20, Aug, 2012),
+            Date(21, Aug, 2012),
             // Kurban
-                || (m == October && d >= 24 && d <= 28))
-                return false;
-        } else if (y == 2013) {
+            Date(24, Oct, 2012), Date(25, Oct, 2012), Date(26, Oct, 2012),
+            Date(27, Oct, 2012), Date(28, Oct, 2012),
+
             // Ramadan
-            if ((m == August && d >= 7 && d <= 10)
+            Date(7, Aug, 2013), Date(8, Aug, 2013), Date(9, Aug, 2013),
+            Date(10, Aug, 2013),
             // Kurban
-                || (m == October && d >= 14 && d <= 18)
+            Date(14, Oct, 2013), Date(15, Oct, 2013), Date(16, Oct, 2013),
+            Date(17, Oct, 2013), Date(18, Oct, 2013),
             // additional holiday for Republic Day
-                || (m == October && d == 28))
-                return false;
-        } else if (y == 2014) {
+            Date(28, Oct, 2013),
+
             // Ramadan
-            if ((m == July && d >= 27 && d <= 30)
+            Date(27, Jul, 2014), Date(28, Jul, 2014), Date(29, Jul, 2014),
+            Date(30, Jul, 2014),
             // Kurban
-                || (m == October && d >= 4 && d <= 7)
+            Date(4, Oct, 2014), Date(5, Oct, 2014), Date(6, Oct, 2014),
+            Date(7, Oct, 2014),
             // additional holiday for Republic Day
-                || (m == October && d == 29))
-                return false;
-		}
-		else if (y == 2015) {
-			// Ramadan
-			if ((m == July && d >= 17 && d <= 19)
-				// Kurban
-				|| (m == October && d >= 24 && d <= 27))
-				return false;
-		}
-		else if (y == 2016) {
-			// Ramadan
-			if ((m == July && d >= 5 && d <= 7)
-				// Kurban
-				|| (m == September && d >= 12 && d <= 15))
-				return false;
-		}
-		else if (y == 2017) {
-			// Ramadan
-			if ((m == June && d >= 25 && d <= 27)
-				// Kurban
-				|| (m == September && d >= 1 && d <= 4))
-				return false;
-		}
-		else if (y == 2018) {
-			// Ramadan
-			if ((m == June && d >= 15 && d <= 17)
-				// Kurban
-				|| (m == August && d >= 21 && d <= 24))
-				return false;
-		}
-		// Note: Holidays >= 2019 are not yet officially anounced by borsaistanbul.com
-		// and need further validation
-		else if (y == 2019) {
-			// Ramadan
-			if ((m == June && d >= 5 && d <= 7)
-				// Kurban
-				|| (m == August && d >= 11 && d <= 14))
-				return false;
-		}
-		else if (y == 2020) {
-			// Ramadan
-			if ((m == May && d >= 24 && d <= 26)
-				// Kurban
-				|| (m == July && d >= 30 && d <= 31))
-				return false;
-		}
-		else if (y == 2021) {
-			// Ramadan
-			if ((m == May && d >= 13 && d <= 14)
-				// Kurban
-				|| (m == July && d >= 19 && d <= 22))
-				return false;
-		}
-		else if (y == 2022) {
-			// Ramadan
-			if ((m == May && d >= 3 && d <= 5)
-				// Kurban
-				|| (m == July && d >= 9 && d <= 12))
-				return false;
-		}
-		else if (y == 2023) {
-			// Ramadan
-			if ((m == April && d >= 22 && d <= 24)
-				// Kurban
-				|| (m == June && d >= 28 && d <= 30))
-				return false;
-		}
-		else if (y == 2024) {
-			// Ramadan
-			if ((m == April && d >= 10 && d <= 12)
-				// Kurban
-				|| (m == June && d >= 17 && d <= 19))
-				return false;
-		}
-		else if (y == 2025) {
-			// Ramadan
-			if ((m == March && d == 31) || (m == April && d >= 1 && d <= 2)
-				// Kurban
-				|| (m == June && d >= 6 && d <= 9))
-				return false;
-		}
-		else if (y == 2026) {
-			// Ramadan
-			if ((m == March && d >= 20 && d <= 22)
-				// Kurban
-				|| (m == May && d >= 26 && d <= 29))
-				return false;
-		}
-		else if (y == 2027) {
-			// Ramadan
-			if ((m == March && d >= 10 && d <= 12)
-				// Kurban
-				|| (m == May && d >= 16 && d <= 19))
-				return false;
-		}
-		else if (y == 2028) {
-			// Ramadan
-			if ((m == February && d >= 27 && d <= 29)
-				// Kurban
-				|| (m == May && d >= 4 && d <= 7))
-				return false;
-		}
-		else if (y == 2029) {
-			// Ramadan
-			if ((m == February && d >= 15 && d <= 17)
-				// Kurban
-				|| (m == April && d >= 23 && d <= 26))
-				return false;
-		}
-		else if (y == 2030) {
-			// Ramadan
-			if ((m == February && d >= 5 && d <= 7)
-				// Kurban
-				|| (m == April && d >= 13 && d <= 16))
-				return false;
-		}
-		else if (y == 2031) {
-			// Ramadan
-			if ((m == January && d >= 25 && d <= 27)
-				// Kurban
-				|| (m == April && d >= 2 && d <= 5))
-				return false;
-		}
-		else if (y == 2032) {
-			// Ramadan
-			if ((m == January && d >= 14 && d <= 16)
-				// Kurban
-				|| (m == March && d >= 21 && d <= 24))
-				return false;
-		}
-		else if (y == 2033) {
-			// Ramadan
-			if ((m == January && d >= 3 && d <= 5) || (m == December && d == 23)
-				// Kurban
-				|| (m == March && d >= 11 && d <= 14))
-				return false;
-		}
-		else if (y == 2034) {
-			// Ramadan
-			if ((m == December && d >= 12 && d <= 14) 
-				// Kurban
-				|| (m == February && d == 28) || (m == March && d >= 1 && d <= 3))
-				return false;
-		}
+            Date(29, Oct, 2014),
+
+            // Ramadan
+            Date(17, Jul, 2015), Date(18, Jul, 2015), Date(19, Jul, 2015),
+            // Kurban
+            Date(24, Oct, 2015), Date(25, Oct, 2015), Date(26, Oct, 2015),
+            Date(27, Oct, 2015),
+
+            // Ramadan
+            Date(5, Jul, 2016), Date(6, Jul, 2016), Date(7, Jul, 2016),
+            // Kurban
+            Date(12, Sep, 2016), Date(13, Sep, 2016), Date(14, Sep, 2016),
+            Date(15, Sep, 2016),
+
+            // Ramadan
+            Date(25, Jun, 2017), Date(26, Jun, 2017), Date(27, Jun, 2017),
+            // Kurban
+            Date(1, Sep, 2017), Date(2, Sep, 2017), Date(3, Sep, 2017),
+            Date(4, Sep, 2017),
+
+            // Ramadan
+            Date(15, Jun, 2018), Date(16, Jun, 2018), Date(17, Jun, 2018),
+            // Kurban
+            Date(21, Aug, 2018), Date(22, Aug, 2018), Date(23, Aug, 2018),
+            Date(24, Aug, 2018),
+
+            // Note: Holidays >= 2019 are not yet officially anounced by
+            // borsaistanbul.com and need further validation
+            // Ramadan
+            Date(5, Jun, 2019), Date(6, Jun, 2019), Date(7, Jun, 2019),
+            // Kurban
+            Date(11, Aug, 2019), Date(12, Aug, 2019), Date(13, Aug, 2019),
+            Date(14, Aug, 2019),
+
+            // Ramadan
+            Date(24, May, 2020), Date(25, May, 2020), Date(26, May, 2020),
+            // Kurban
+            Date(30, Jul, 2020), Date(31, Jul, 2020),
+
+            // Ramadan
+            Date(13, May, 2021), Date(14, May, 2021),
+            // Kurban
+            Date(19, Jul, 2021), Date(20, Jul, 2021), Date(21, Jul, 2021),
+            Date(22, Jul, 2021),
+
+            // Ramadan
+            Date(3, May, 2022), Date(4, May, 2022), Date(5, May, 2022),
+            // Kurban
+            Date(9, Jul, 2022), Date(10, Jul, 2022), Date(11, Jul, 2022),
+            Date(12, Jul, 2022),
+
+            // Ramadan
+            Date(22, Apr, 2023), Date(23, Apr, 2023), Date(24, Apr, 2023),
+            // Kurban
+            Date(28, Jun, 2023), Date(29, Jun, 2023), Date(30, Jun, 2023),
+
+            // Ramadan
+            Date(10, Apr, 2024), Date(11, Apr, 2024), Date(12, Apr, 2024),
+            // Kurban
+            Date(17, Jun, 2024), Date(18, Jun, 2024), Date(19, Jun, 2024),
+
+            // Ramadan
+            Date(31, Mar, 2025),
+            Date(1, Apr, 2025), Date(2, Apr, 2025),
+            // Kurban
+            Date(6, Jun, 2025), Date(7, Jun, 2025), Date(8, Jun, 2025),
+            Date(9, Jun, 2025),
+
+            // Ramadan
+            Date(20, Mar, 2026), Date(21, Mar, 2026), Date(22, Mar, 2026),
+            // Kurban
+            Date(26, May, 2026), Date(27, May, 2026), Date(28, May, 2026),
+            Date(29, May, 2026),
+
+            // Ramadan
+            Date(10, Mar, 2027), Date(11, Mar, 2027), Date(12, Mar, 2027),
+            // Kurban
+            Date(16, May, 2027), Date(17, May, 2027), Date(18, May, 2027),
+            Date(19, May, 2027),
+
+            // Ramadan
+            Date(27, Feb, 2028), Date(28, Feb, 2028), Date(29, Feb, 2028),
+            // Kurban
+            Date(4, May, 2028), Date(5, May, 2028), Date(6, May, 2028),
+            Date(7, May, 2028),
+
+            // Ramadan
+            Date(15, Feb, 2029), Date(16, Feb, 2029), Date(17, Feb, 2029),
+            // Kurban
+            Date(23, Apr, 2029), Date(24, Apr, 2029), Date(25, Apr, 2029),
+            Date(26, Apr, 2029),
+
+            // Ramadan
+            Date(5, Feb, 2030), Date(6, Feb, 2030), Date(7, Feb, 2030),
+            // Kurban
+            Date(13, Apr, 2030), Date(14, Apr, 2030), Date(15, Apr, 2030),
+            Date(16, Apr, 2030),
+
+            // Ramadan
+            Date(25, Jan, 2031), Date(26, Jan, 2031), Date(27, Jan, 2031),
+            // Kurban
+            Date(2, Apr, 2031), Date(3, Apr, 2031), Date(4, Apr, 2031),
+            Date(5, Apr, 2031),
+
+            // Ramadan
+            Date(14, Jan, 2032), Date(15, Jan, 2032), Date(16, Jan, 2032),
+            // Kurban
+            Date(21, Mar, 2032), Date(22, Mar, 2032), Date(23, Mar, 2032),
+            Date(24, Mar, 2032),
+
+            // Ramadan
+            Date(3, Jan, 2033), Date(4, Jan, 2033), Date(5, Jan, 2033),
+            Date(23, Dec, 2033),
+            // Kurban
+            Date(11, Mar, 2033), Date(12, Mar, 2033), Date(13, Mar, 2033),
+            Date(14, Mar, 2033),
+
+            // Ramadan
+            Date(12, Dec, 2034), Date(13, Dec, 2034), Date(14, Dec, 2034),
+            // Kurban
+            Date(28, Feb, 2034),
+            Date(1, Mar, 2034), Date(2, Mar, 2034), Date(3, Mar, 2034)
+        };
+        static const Size n =
+            sizeof(special_holidays)/sizeof(special_holidays[0]);
+        static const HolidayTable specialHolidays(special_holidays+0,
+                                                  special_holidays+n);
+
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+
+        if (isWeekend(w)
+            // New Year's Day
+            || (d == 1 && m == January)
+            // 23 nisan / National Holiday
+            || (d == 23 && m == April)
+            // 1 may/ National Holiday
+            || (d == 1 && m == May)
+            // 19 may/ National Holiday
+            || (d == 19 && m == May)
+            // 30 aug/ National Holiday
+            || (d == 30 && m == August)
+            ///29 ekim  National Holiday
+            || (d == 29 && m == October)
+            // holidays set year by year
+            || specialHolidays.isHoliday(date))
+            return false;
         return true;
     }
 
@@ -54,8 +54,8 @@ namespace QuantLib {
       private:
         class Impl : public Calendar::Impl {
           public:
+            Impl() : Calendar::Impl(weekendOf(Saturday, Sunday)) {}
             std::string name() const { return "Turkey"; }
-            bool isWeekend(Weekday) const;
             bool isBusinessDay(const Date&) const;
         };
       public:
@@ -19,10 +19,64 @@
 */
 
 #include <ql/time/calendars/unitedkingdom.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
 
+    namespace {
+
+        // settlement, exchange and metals markets share the same holidays
+        const HolidayTable& ukHolidays(Day (*easterMonday)(Year)) {
+            static const HolidayRule rules[] = {
+                // New Year's Day (possibly moved to Monday)
+                HolidayRule::fixed(January, 1, HolidayRule::WeekendToMonday),
+                // Good Friday
+                HolidayRule::easter(-3),
+                // Easter Monday
+                HolidayRule::easter(0),
+                // first Monday of May (Early May Bank Holiday)
+                // moved to May 8th in 1995 and 2020 for V.E. day
+                HolidayRule::nthWeekday(1, Monday, May).until(1994),
+                HolidayRule::nthWeekday(1, Monday, May).since(1996)
+                    .until(2019),
+                HolidayRule::nthWeekday(1, Monday, May).since(2021),
+                HolidayRule::fixed(May, 8).only(1995),
+                HolidayRule::fixed(May, 8).only(2020),
+                // last Monday of May (Spring Bank Holiday)
+                HolidayRule::lastWeekday(Monday, May).until(2001),
+                HolidayRule::lastWeekday(Monday, May).since(2003)
+                    .until(2011),
+                HolidayRule::lastWeekday(Monday, May).since(2013),
+                // last Monday of August (Summer Bank Holiday)
+                HolidayRule::lastWeekday(Monday, August),
+                // Christmas (possibly moved to Monday or Tuesday)
+                HolidayRule::fixed(December, 25,
+                                   HolidayRule::WeekendToTwoDaysLater),
+                // Boxing Day (possibly moved to Monday or Tuesday)
+                HolidayRule::fixed(December, 26,
+                                   HolidayRule::WeekendToTwoDaysLater),
+                // June 3rd, 2002 only (Golden Jubilee Bank Holiday)
+                // June 4rd, 2002 only (special Spring Bank Holiday)
+                HolidayRule::fixed(June, 3).only(2002),
+                HolidayRule::fixed(June, 4).only(2002),
+                // April 29th, 2011 only (Royal Wedding Bank Holiday)
+                HolidayRule::fixed(April, 29).only(2011),
+                // June 4th, 2012 only (Diamond Jubilee Bank Holiday)
+                // June 5th, 2012 only (Special Spring Bank Holiday)
+                HolidayRule::fixed(June, 4).only(2012),
+                HolidayRule::fixed(June, 5).only(2012),
+                // December 31st, 1999 only
+                HolidayRule::fixed(December, 31).only(1999)
+            };
+            static const Size n = sizeof(rules)/sizeof(rules[0]);
+            static const HolidayTable holidays(rules+0, rules+n,
+                                               easterMonday);
+            return holidays;
+        }
+
+    }
+
     UnitedKingdom::UnitedKingdom(UnitedKingdom::Market market) {
         // all calendar instances on the same market share the same
         // implementation instance
@@ -48,131 +102,20 @@ namespace QuantLib {
     }
 
     bool UnitedKingdom::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
-            // New Year's Day (possibly moved to Monday)
-            || ((d == 1 || ((d == 2 || d == 3) && w == Monday)) &&
-                m == January)
-            // Good Friday
-            || (dd == em-3)
-            // Easter Monday
-            || (dd == em)
-            // first Monday of May (Early May Bank Holiday)
-            // moved to May 8th in 1995 and 2020 for V.E. day
-            || (d <= 7 && w == Monday && m == May && y != 1995 && y != 2020)
-            || (d == 8 && m == May && (y == 1995 || y == 2020))
-            // last Monday of May (Spring Bank Holiday)
-            || (d >= 25 && w == Monday && m == May && y != 2002 && y != 2012)
-            // last Monday of August (Summer Bank Holiday)
-            || (d >= 25 && w == Monday && m == August)
-            // Christmas (possibly moved to Monday or Tuesday)
-            || ((d == 25 || (d == 27 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // Boxing Day (possibly moved to Monday or Tuesday)
-            || ((d == 26 || (d == 28 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // June 3rd, 2002 only (Golden Jubilee Bank Holiday)
-            // June 4rd, 2002 only (special Spring Bank Holiday)
-            || ((d == 3 || d == 4) && m == June && y == 2002)
-            // April 29th, 2011 only (Royal Wedding Bank Holiday)
-            || (d == 29 && m == April && y == 2011)
-            // June 4th, 2012 only (Diamond Jubilee Bank Holiday)
-            // June 5th, 2012 only (Special Spring Bank Holiday)
-            || ((d == 4 || d == 5) && m == June && y == 2012)
-            // December 31st, 1999 only
-            || (d == 31 && m == December && y == 1999))
-            return false;
-        return true;
+        return !isWeekend(date.weekday()) &&
+            !ukHolidays(easterMonday).isHoliday(date);
     }
 
 
     bool UnitedKingdom::ExchangeImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
-            // New Year's Day (possibly moved to Monday)
-            || ((d == 1 || ((d == 2 || d == 3) && w == Monday)) &&
-                m == January)
-            // Good Friday
-            || (dd == em-3)
-            // Easter Monday
-            || (dd == em)
-            // first Monday of May (Early May Bank Holiday)
-            // moved to May 8th in 1995 and 2020 for V.E. day
-            || (d <= 7 && w == Monday && m == May && y != 1995 && y != 2020)
-            || (d == 8 && m == May && (y == 1995 || y == 2020))
-            // last Monday of May (Spring Bank Holiday)
-            || (d >= 25 && w == Monday && m == May && y != 2002 && y != 2012)
-            // last Monday of August (Summer Bank Holiday)
-            || (d >= 25 && w == Monday && m == August)
-            // Christmas (possibly moved to Monday or Tuesday)
-            || ((d == 25 || (d == 27 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // Boxing Day (possibly moved to Monday or Tuesday)
-            || ((d == 26 || (d == 28 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // June 3rd, 2002 only (Golden Jubilee Bank Holiday)
-            // June 4rd, 2002 only (special Spring Bank Holiday)
-            || ((d == 3 || d == 4) && m == June && y == 2002)
-            // April 29th, 2011 only (Royal Wedding Bank Holiday)
-            || (d == 29 && m == April && y == 2011)
-            // June 4th, 2012 only (Diamond Jubilee Bank Holiday)
-            // June 5th, 2012 only (Special Spring Bank Holiday)
-            || ((d == 4 || d == 5) && m == June && y == 2012)
-            // December 31st, 1999 only
-            || (d == 31 && m == December && y == 1999))
-            return false;
-        return true;
+        return !isWeekend(date.weekday()) &&
+            !ukHolidays(easterMonday).isHoliday(date);
     }
 
 
     bool UnitedKingdom::MetalsImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
-            // New Year's Day (possibly moved to Monday)
-            || ((d == 1 || ((d == 2 || d == 3) && w == Monday)) &&
-                m == January)
-            // Good Friday
-            || (dd == em-3)
-            // Easter Monday
-            || (dd == em)
-            // first Monday of May (Early May Bank Holiday)
-            // moved to May 8th in 1995 and 2020 for V.E. day
-            || (d <= 7 && w == Monday && m == May && y != 1995 && y != 2020)
-            || (d == 8 && m == May && (y == 1995 || y == 2020))
-            // last Monday of May (Spring Bank Holiday)
-            || (d >= 25 && w == Monday && m == May && y != 2002 && y != 2012)
-            // last Monday of August (Summer Bank Holiday)
-            || (d >= 25 && w == Monday && m == August)
-            // Christmas (possibly moved to Monday or Tuesday)
-            || ((d == 25 || (d == 27 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // Boxing Day (possibly moved to Monday or Tuesday)
-            || ((d == 26 || (d == 28 && (w == Monday || w == Tuesday)))
-                && m == December)
-            // June 3rd, 2002 only (Golden Jubilee Bank Holiday)
-            // June 4rd, 2002 only (special Spring Bank Holiday)
-            || ((d == 3 || d == 4) && m == June && y == 2002)
-            // April 29th, 2011 only (Royal Wedding Bank Holiday)
-            || (d == 29 && m == April && y == 2011)
-            // June 4th, 2012 only (Diamond Jubilee Bank Holiday)
-            // June 5th, 2012 only (Special Spring Bank Holiday)
-            || ((d == 4 || d == 5) && m == June && y == 2012)
-            // December 31st, 1999 only
-            || (d == 31 && m == December && y == 1999))
-            return false;
-        return true;
+        return !isWeekend(date.weekday()) &&
+            !ukHolidays(easterMonday).isHoliday(date);
     }
 
 }
@@ -22,6 +22,7 @@
 */
 
 #include <ql/time/calendars/unitedstates.hpp>
+#include <ql/time/holidayrule.hpp>
 #include <ql/errors.hpp>
 
 namespace QuantLib {
@@ -57,32 +58,6 @@ namespace QuantLib {
             return d <= 7 && w == Monday && m == September;
         }
 
-        bool isColumbusDay(Day d, Month m, Year y, Weekday w) {
-            // second Monday in October
-            return (d >= 8 && d <= 14) && w == Monday && m == October
-                && y >= 1971;
-        }
-
-        bool isVeteransDay(Day d, Month m, Year y, Weekday w) {
-            if (y <= 1970 || y >= 1978) {
-                // November 11th, adjusted
-                return (d == 11 || (d == 12 && w == Monday) ||
-                        (d == 10 && w == Friday)) && m == November;
-            } else {
-                // fourth Monday in October
-                return (d >= 22 && d <= 28) && w == Monday && m == October;
-            }
-        }
-     
-        bool isVeteransDayNoSaturday(Day d, Month m, Year y, Weekday w) {
-            if (y <= 1970 || y >= 1978) {
-                // November 11th, adjusted, but no Saturday to Friday
-                return (d == 11 || (d == 12 && w == Monday)) && m == November;
-            } else {
-                // fourth Monday in October
-                return (d >= 22 && d <= 28) && w == Monday && m == October;
-            }
-        }
     }
     
     UnitedStates::UnitedStates(UnitedStates::Market market) {
@@ -126,47 +101,52 @@ namespace QuantLib {
 
 
     bool UnitedStates::SettlementImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        if (isWeekend(w)
-            // New Year's Day (possibly moved to Monday if on Sunday)
-            || ((d == 1 || (d == 2 && w == Monday)) && m == January)
-            // (or to Friday if on Saturday)
-            || (d == 31 && w == Friday && m == December)
+        static const HolidayRule rules[] = {
+            // New Year's Day (Monday if Sunday or Friday if Saturday)
+            HolidayRule::fixed(January, 1, HolidayRule::NearestWeekday),
             // Martin Luther King's birthday (third Monday in January)
-            || ((d >= 15 && d <= 21) && w == Monday && m == January
-                && y >= 1983)
+            HolidayRule::nthWeekday(3, Monday, January).since(1983),
             // Washington's birthday (third Monday in February)
-            || isWashingtonBirthday(d, m, y, w)
+            HolidayRule::nthWeekday(3, Monday, February).since(1971),
+            HolidayRule::fixed(February, 22, HolidayRule::NearestWeekday)
+                .until(1970),
             // Memorial Day (last Monday in May)
-            || isMemorialDay(d, m, y, w)
+            HolidayRule::lastWeekday(Monday, May).since(1971),
+            HolidayRule::fixed(May, 30, HolidayRule::NearestWeekday)
+                .until(1970),
             // Independence Day (Monday if Sunday or Friday if Saturday)
-            || ((d == 4 || (d == 5 && w == Monday) ||
-                 (d == 3 && w == Friday)) && m == July)
+            HolidayRule::fixed(July, 4, HolidayRule::NearestWeekday),
             // Labor Day (first Monday in September)
-            || isLaborDay(d, m, y, w)
+            HolidayRule::nthWeekday(1, Monday, September),
             // Columbus Day (second Monday in October)
-            || isColumbusDay(d, m, y, w)
-            // Veteran's Day (Monday if Sunday or Friday if Saturday)
-            || isVeteransDay(d, m, y, w)
+            HolidayRule::nthWeekday(2, Monday, October).since(1971),
+            // Veteran's Day (Monday if Sunday or Friday if Saturday),
+            // moved to the fourth Monday in October from 1971 to 1977
+            HolidayRule::fixed(November, 11, HolidayRule::NearestWeekday)
+                .until(1970),
+            HolidayRule::nthWeekday(4, Monday, October).since(1971)
+                .until(1977),
+            HolidayRule::fixed(November, 11, HolidayRule::NearestWeekday)
+                .since(1978),
             // Thanksgiving Day (fourth Thursday in November)
-            || ((d >= 22 && d <= 28) && w == Thursday && m == November)
+            HolidayRule::nthWeekday(4, Thursday, November),
             // Christmas (Monday if Sunday or Friday if Saturday)
-            || ((d == 25 || (d == 26 && w == Monday) ||
-                 (d == 24 && w == Friday)) && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 25, HolidayRule::NearestWeekday)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
     bool UnitedStates::LiborImpactImpl::isBusinessDay(const Date& date) const {
         // Since 2015 Independence Day only impacts Libor if it falls
         // on a weekday
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth;
+        Month m = fields.month;
+        Year y = fields.year;
         if (((d == 5 && w == Monday) ||
             (d == 3 && w == Friday)) && m == July && y >= 2015)
             return true;
@@ -174,10 +154,11 @@ namespace QuantLib {
     }
 
     bool UnitedStates::NyseImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
+        const Date::Fields fields = date.fields();
+        Weekday w = fields.weekday;
+        Day d = fields.dayOfMonth, dd = fields.dayOfYear;
+        Month m = fields.month;
+        Year y = fields.year;
         Day em = easterMonday(y);
         if (isWeekend(w)
             // New Year's Day (possibly moved to Monday if on Sunday)
@@ -259,95 +240,109 @@ namespace QuantLib {
 
 
     bool UnitedStates::GovernmentBondImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth(), dd = date.dayOfYear();
-        Month m = date.month();
-        Year y = date.year();
-        Day em = easterMonday(y);
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day (possibly moved to Monday if on Sunday)
-            || ((d == 1 || (d == 2 && w == Monday)) && m == January)
+            HolidayRule::fixed(January, 1, HolidayRule::SundayToMonday),
             // Martin Luther King's birthday (third Monday in January)
-            || ((d >= 15 && d <= 21) && w == Monday && m == January
-                && y >= 1983)
+            HolidayRule::nthWeekday(3, Monday, January).since(1983),
             // Washington's birthday (third Monday in February)
-            || isWashingtonBirthday(d, m, y, w)
+            HolidayRule::nthWeekday(3, Monday, February).since(1971),
+            HolidayRule::fixed(February, 22, HolidayRule::NearestWeekday)
+                .until(1970),
             // Good Friday
-            || (dd == em-3)
+            HolidayRule::easter(-3),
             // Memorial Day (last Monday in May)
-            || isMemorialDay(d, m, y, w)
+            HolidayRule::lastWeekday(Monday, May).since(1971),
+            HolidayRule::fixed(May, 30, HolidayRule::NearestWeekday)
+                .until(1970),
             // Independence Day (Monday if Sunday or Friday if Saturday)
-            || ((d == 4 || (d == 5 && w == Monday) ||
-                 (d == 3 && w == Friday)) && m == July)
+            HolidayRule::fixed(July, 4, HolidayRule::NearestWeekday),
             // Labor Day (first Monday in September)
-            || isLaborDay(d, m, y, w)
+            HolidayRule::nthWeekday(1, Monday, September),
             // Columbus Day (second Monday in October)
-            || isColumbusDay(d, m, y, w)
-            // Veteran's Day (Monday if Sunday)
-            || isVeteransDayNoSaturday(d, m, y, w)
+            HolidayRule::nthWeekday(2, Monday, October).since(1971),
+            // Veteran's Day (Monday if Sunday), moved to the fourth
+            // Monday in October from 1971 to 1977
+            HolidayRule::fixed(November, 11, HolidayRule::SundayToMonday)
+                .until(1970),
+            HolidayRule::nthWeekday(4, Monday, October).since(1971)
+                .until(1977),
+            HolidayRule::fixed(November, 11, HolidayRule::SundayToMonday)
+                .since(1978),
             // Thanksgiving Day (fourth Thursday in November)
-            || ((d >= 22 && d <= 28) && w == Thursday && m == November)
+            HolidayRule::nthWeekday(4, Thursday, November),
             // Christmas (Monday if Sunday or Friday if Saturday)
-            || ((d == 25 || (d == 26 && w == Monday) ||
-                 (d == 24 && w == Friday)) && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 25, HolidayRule::NearestWeekday)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
 
     bool UnitedStates::NercImpl::isBusinessDay(const Date& date) const {
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day (possibly moved to Monday if on Sunday)
-            || ((d == 1 || (d == 2 && w == Monday)) && m == January)
+            HolidayRule::fixed(January, 1, HolidayRule::SundayToMonday),
             // Memorial Day (last Monday in May)
-            || isMemorialDay(d, m, y, w)
+            HolidayRule::lastWeekday(Monday, May).since(1971),
+            HolidayRule::fixed(May, 30, HolidayRule::NearestWeekday)
+                .until(1970),
             // Independence Day (Monday if Sunday)
-            || ((d == 4 || (d == 5 && w == Monday)) && m == July)
+            HolidayRule::fixed(July, 4, HolidayRule::SundayToMonday),
             // Labor Day (first Monday in September)
-            || isLaborDay(d, m, y, w)
+            HolidayRule::nthWeekday(1, Monday, September),
             // Thanksgiving Day (fourth Thursday in November)
-            || ((d >= 22 && d <= 28) && w == Thursday && m == November)
+            HolidayRule::nthWeekday(4, Thursday, November),
             // Christmas (Monday if Sunday)
-            || ((d == 25 || (d == 26 && w == Monday)) && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 25, HolidayRule::SundayToMonday)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
  
  
     bool UnitedStates::FederalReserveImpl::isBusinessDay(const Date& date) const {
         // see https://www.frbservices.org/holidayschedules/ for details
-        Weekday w = date.weekday();
-        Day d = date.dayOfMonth();
-        Month m = date.month();
-        Year y = date.year();
-        if (isWeekend(w)
+        static const HolidayRule rules[] = {
             // New Year's Day (possibly moved to Monday if on Sunday)
-            || ((d == 1 || (d == 2 && w == Monday)) && m == January)
+            HolidayRule::fixed(January, 1, HolidayRule::SundayToMonday),
             // Martin Luther King's birthday (third Monday in January)
-            || ((d >= 15 && d <= 21) && w == Monday && m == January
-                && y >= 1983)
+            HolidayRule::nthWeekday(3, Monday, January).since(1983),
             // Washington's birthday (third Monday in February)
-            || isWashingtonBirthday(d, m, y, w)
+            HolidayRule::nthWeekday(3, Monday, February).since(1971),
+            HolidayRule::fixed(February, 22, HolidayRule::NearestWeekday)
+                .until(1970),
             // Memorial Day (last Monday in May)
-            || isMemorialDay(d, m, y, w)
+            HolidayRule::lastWeekday(Monday, May).since(1971),
+            HolidayRule::fixed(May, 30, HolidayRule::NearestWeekday)
+                .until(1970),
             // Independence Day (Monday if Sunday)
-            || ((d == 4 || (d == 5 && w == Monday)) && m == July)
+            HolidayRule::fixed(July, 4, HolidayRule::SundayToMonday),
             // Labor Day (first Monday in September)
-            || isLaborDay(d, m, y, w)
+            HolidayRule::nthWeekday(1, Monday, September),
             // Columbus Day (second Monday in October)
-            || isColumbusDay(d, m, y, w)
-            // Veteran's Day (Monday if Sunday)
-            || isVeteransDayNoSaturday(d, m, y, w)
+            HolidayRule::nthWeekday(2, Monday, October).since(1971),
+            // Veteran's Day (Monday if Sunday), moved to the fourth
+            // Monday in October from 1971 to 1977
+            HolidayRule::fixed(November, 11, HolidayRule::SundayToMonday)
+                .until(1970),
+            HolidayRule::nthWeekday(4, Monday, October).since(1971)
+                .until(1977),
+            HolidayRule::fixed(November, 11, HolidayRule::SundayToMonday)
+                .since(1978),
             // Thanksgiving Day (fourth Thursday in November)
-            || ((d >= 22 && d <= 28) && w == Thursday && m == November)
+            HolidayRule::nthWeekday(4, Thursday, November),
             // Christmas (Monday if Sunday)
-            || ((d == 25 || (d == 26 && w == Monday)) && m == December))
-            return false;
-        return true;
+            HolidayRule::fixed(December, 25, HolidayRule::SundayToMonday)
+        };
+        static const Size n = sizeof(rules)/sizeof(rules[0]);
+        static const HolidayTable holidays(rules+0, rules+n, easterMonday);
+
+        return !isWeekend(date.weekday()) && !holidays.isHoliday(date);
     }
 
 }
@@ -78,14 +78,7 @@ namespace QuantLib {
     }
 
     Month Date::month() const {
-        Day d = dayOfYear(); // dayOfYear is 1 based
-        Integer m = d/30 + 1;
-        bool leap = isLeap(year());
-        while (d <= monthOffset(Month(m),leap))
-            --m;
-        while (d > monthOffset(Month(m+1),leap))
-            ++m;
-        return Month(m);
+        return fields().month;
     }
 
     Year Date::year() const {
@@ -96,6 +89,32 @@ namespace QuantLib {
         return y;
     }
 
+    Date::Fields Date::fields() const {
+        // days-to-civil conversion from H. Hinnant, "chrono-Compatible
+        // Low-Level Date Algorithms". Years are counted from March 1st,
+        // so that the leap day is the last day of the year, and grouped
+        // in 400-year eras of 146097 days; 693899 moves the serial number
+        // to the days elapsed since March 1st of year 0.
+        const Date::serial_type z = serialNumber_ + 693899;
+        const Date::serial_type era = z / 146097;
+        // day and year of the era, in [0, 146096] and [0, 399]
+        const Date::serial_type doe = z - era * 146097;
+        const Date::serial_type yoe =
+            (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+        // day of the year and month, counting from March, in
+        // [0, 365] and [0, 11]
+        const Date::serial_type doy = doe - (365*yoe + yoe/4 - yoe/100);
+        const Date::serial_type mp = (5*doy + 2) / 153;
+
+        Fields f;
+        f.dayOfMonth = Day(doy - (153*mp + 2)/5 + 1);
+        f.month = Month(mp < 10 ? mp + 3 : mp - 9);
+        f.year = Year(era*400 + yoe + (f.month <= February ? 1 : 0));
+        f.dayOfYear = Day(serialNumber_ - yearOffset(f.year));
+        f.weekday = weekday();
+        return f;
+    }
+
     Date& Date::operator+=(Date::serial_type days) {
         Date::serial_type serial = serialNumber_ + days;
         checkSerialNumber(serial);
@@ -141,9 +160,10 @@ namespace QuantLib {
           case Weeks:
             return date + 7*n;
           case Months: {
-            Day d = date.dayOfMonth();
-            Integer m = Integer(date.month())+n;
-            Year y = date.year();
+            const Fields fields = date.fields();
+            Day d = fields.dayOfMonth;
+            Integer m = Integer(fields.month)+n;
+            Year y = fields.year;
             while (m > 12) {
                 m -= 12;
                 y += 1;
@@ -164,9 +184,10 @@ namespace QuantLib {
             return Date(d, Month(m), y);
           }
           case Years: {
-              Day d = date.dayOfMonth();
-              Month m = date.month();
-              Year y = date.year()+n;
+              const Fields fields = date.fields();
+              Day d = fields.dayOfMonth;
+              Month m = fields.month;
+              Year y = fields.year+n;
 
               QL_ENSURE(y >= 1900 && y <= 2199,
                         "year " << y << " out of bounds. "
@@ -558,6 +579,26 @@ namespace QuantLib {
         return dateTime_.date().year();
     }
 
+    void Date::uncheckedIncrement() {
+        // the boost date checks its range anyway
+        ++*this;
+    }
+
+    void Date::uncheckedDecrement() {
+        --*this;
+    }
+
+    Date::Fields Date::fields() const {
+        const boost::gregorian::date date = dateTime_.date();
+        Fields f;
+        f.year = date.year();
+        f.month = mapBoostDateType2QL<compatibleEnums>(date.month());
+        f.dayOfMonth = date.day();
+        f.dayOfYear = date.day_of_year();
+        f.weekday = mapBoostDateType2QL<compatibleEnums>(date.day_of_week());
+        return f;
+    }
+
     Hour Date::hours() const {
         return dateTime_.time_of_day().hours();
     }
@@ -124,6 +124,19 @@ namespace QuantLib {
       public:
         //! serial number type
         typedef boost::int_fast32_t serial_type;
+        //! calendar fields of a date
+        /*! Holidays rules usually need most of these at once;
+            Date::fields() derives them together instead of once
+            per inspector.
+        */
+        struct Fields {
+            Year year;
+            Month month;
+            Day dayOfMonth;
+            //! One-based (Jan 1st = 1)
+            Day dayOfYear;
+            Weekday weekday;
+        };
         //! \name constructors
         //@{
         //! Default constructor returning a null date.
@@ -151,6 +164,8 @@ namespace QuantLib {
         Day dayOfYear() const;
         Month month() const;
         Year year() const;
+        //! all of the above at once
+        Fields fields() const;
         Date::serial_type serialNumber() const;
 
 #ifdef QL_HIGH_RESOLUTION_DATE
@@ -195,6 +210,19 @@ namespace QuantLib {
         Date operator-(const Period&) const;
         //@}
 
+        //! \name unchecked date algebra
+        /*! Unlike the operators above, these don't check that the
+            result lies within [minDate(), maxDate()]. They are meant
+            for internal loops stepping through many dates, which
+            check their bounds once instead of at every step.
+        */
+        //@{
+        //! 1-day increment without range check
+        void uncheckedIncrement();
+        //! 1-day decrement without range check
+        void uncheckedDecrement();
+        //@}
+
         //! \name static methods
         //@{
         //! today's date.
@@ -364,7 +392,7 @@ namespace QuantLib {
     }
 
     inline Day Date::dayOfMonth() const {
-        return dayOfYear() - monthOffset(month(),isLeap(year()));
+        return fields().dayOfMonth;
     }
 
     inline Day Date::dayOfYear() const {
@@ -379,6 +407,14 @@ namespace QuantLib {
         return Date(serialNumber_+days);
     }
 
+    inline void Date::uncheckedIncrement() {
+        ++serialNumber_;
+    }
+
+    inline void Date::uncheckedDecrement() {
+        --serialNumber_;
+    }
+
     inline Date Date::operator-(Date::serial_type days) const {
         return Date(serialNumber_-days);
     }
@@ -392,13 +428,16 @@ namespace QuantLib {
     }
 
     inline Date Date::endOfMonth(const Date& d) {
-        Month m = d.month();
-        Year y = d.year();
+        const Fields fields = d.fields();
+        Month m = fields.month;
+        Year y = fields.year;
         return Date(monthLength(m, isLeap(y)), m, y);
     }
 
     inline bool Date::isEndOfMonth(const Date& d) {
-       return (d.dayOfMonth() == monthLength(d.month(), isLeap(d.year())));
+        const Fields fields = d.fields();
+        return (fields.dayOfMonth ==
+                monthLength(fields.month, isLeap(fields.year)));
     }
 
     inline Date::serial_type operator-(const Date& d1, const Date& d2) {
@@ -0,0 +1,177 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of almanac, and is not part of the QuantLib
+ distribution. It follows the QuantLib layout so that it can live
+ alongside the synced QuantLib sources.
+*/
+
+#include <ql/time/holidayrule.hpp>
+#include <ql/errors.hpp>
+#include <limits>
+
+namespace QuantLib {
+
+    namespace {
+
+        // Serial numbers are computed by hand rather than through Date,
+        // so that observed holidays can be derived from dates in the
+        // years just outside the range (e.g., a New Year's Day falling
+        // on a Saturday in 2200 is observed on December 31st, 2199).
+
+        Date::serial_type dateSerial(Day d, Month m, Year y) {
+            // days since 1970-01-01 in the proleptic Gregorian calendar,
+            // shifted to the Excel-compatible serial numbers used by Date
+            Integer yy = (m <= February) ? y - 1 : y;
+            Integer era = yy / 400;
+            Integer yoe = yy - era * 400;
+            Integer mp = (m + 9) % 12;
+            Integer doy = (153 * mp + 2) / 5 + d - 1;
+            Integer doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + doe - 719468 + 25569;
+        }
+
+        Weekday weekday(Date::serial_type s) {
+            Integer w = static_cast<Integer>(s % 7);
+            return Weekday(w == 0 ? 7 : w);
+        }
+
+        Day daysInMonth(Month m, Year y) {
+            static const Day days[] = {
+                31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+            };
+            bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+            return days[m - 1] + ((m == February && leap) ? 1 : 0);
+        }
+
+    }
+
+    HolidayRule::HolidayRule(Kind kind, Month m, Integer n, Weekday w,
+                             Observance observance)
+    : kind_(kind), month_(m), n_(n), weekday_(w), observance_(observance),
+      firstYear_(std::numeric_limits<Year>::min()),
+      lastYear_(std::numeric_limits<Year>::max()) {}
+
+    HolidayRule HolidayRule::fixed(Month m, Day d, Observance observance) {
+        return HolidayRule(Fixed, m, d, Monday, observance);
+    }
+
+    HolidayRule HolidayRule::nthWeekday(Size n, Weekday w, Month m) {
+        return HolidayRule(NthWeekday, m, static_cast<Integer>(n), w, Actual);
+    }
+
+    HolidayRule HolidayRule::lastWeekday(Weekday w, Month m) {
+        return HolidayRule(LastWeekday, m, 0, w, Actual);
+    }
+
+    HolidayRule HolidayRule::easter(Integer offset) {
+        return HolidayRule(Easter, January, offset, Monday, Actual);
+    }
+
+    HolidayRule HolidayRule::since(Year y) const {
+        HolidayRule rule = *this;
+        rule.firstYear_ = y;
+        return rule;
+    }
+
+    HolidayRule HolidayRule::until(Year y) const {
+        HolidayRule rule = *this;
+        rule.lastYear_ = y;
+        return rule;
+    }
+
+    HolidayRule HolidayRule::only(Year y) const {
+        return since(y).until(y);
+    }
+
+    Date::serial_type HolidayRule::serialNumber(
+                                     Year y,
+                                     Day (*easterMonday)(Year)) const {
+        if (y < firstYear_ || y > lastYear_)
+            return 0;
+
+        Date::serial_type s = 0;
+        switch (kind_) {
+          case Fixed:
+            s = dateSerial(n_, month_, y);
+            break;
+          case NthWeekday: {
+              Date::serial_type first = dateSerial(1, month_, y);
+              s = first + (weekday_ - weekday(first) + 7) % 7 + 7 * (n_ - 1);
+              break;
+          }
+          case LastWeekday: {
+              Date::serial_type last =
+                  dateSerial(daysInMonth(month_, y), month_, y);
+              s = last - (weekday(last) - weekday_ + 7) % 7;
+              break;
+          }
+          case Easter:
+            if (y < Date::minDate().year() || y > Date::maxDate().year())
+                return 0;
+            s = dateSerial(1, January, y) - 1
+                + easterMonday(y) + n_;
+            break;
+          default:
+            QL_FAIL("unknown holiday rule");
+        }
+
+        Weekday w = weekday(s);
+        switch (observance_) {
+          case Actual:
+            break;
+          case SundayToMonday:
+            if (w == Sunday)
+                s += 1;
+            break;
+          case NearestWeekday:
+            if (w == Saturday)
+                s -= 1;
+            else if (w == Sunday)
+                s += 1;
+            break;
+          case WeekendToMonday:
+            if (w == Saturday)
+                s += 2;
+            else if (w == Sunday)
+                s += 1;
+            break;
+          case WeekendToTwoDaysLater:
+            if (w == Saturday || w == Sunday)
+                s += 2;
+            break;
+          default:
+            QL_FAIL("unknown observance");
+        }
+        return s;
+    }
+
+    HolidayTable::HolidayTable(const HolidayRule* begin,
+                               const HolidayRule* end,
+                               Day (*easterMonday)(Year)) {
+        Date::serial_type first = Date::minDate().serialNumber();
+        Date::serial_type last = Date::maxDate().serialNumber();
+        holidays_.resize(static_cast<Size>(last - first) + 1, false);
+
+        // one year on either side, for holidays observed across the
+        // end of a year
+        for (Year y = Date::minDate().year() - 1;
+             y <= Date::maxDate().year() + 1; ++y) {
+            for (const HolidayRule* rule = begin; rule != end; ++rule) {
+                Date::serial_type s = rule->serialNumber(y, easterMonday);
+                if (s >= first && s <= last)
+                    holidays_[s - first] = true;
+            }
+        }
+    }
+
+    HolidayTable::HolidayTable(const Date* begin, const Date* end) {
+        Date::serial_type first = Date::minDate().serialNumber();
+        Date::serial_type last = Date::maxDate().serialNumber();
+        holidays_.resize(static_cast<Size>(last - first) + 1, false);
+
+        for (const Date* d = begin; d != end; ++d)
+            holidays_[d->serialNumber() - first] = true;
+    }
+
+}
@@ -0,0 +1,117 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of almanac, and is not part of the QuantLib
+ distribution. It follows the QuantLib layout so that it can live
+ alongside the synced QuantLib sources.
+*/
+
+/*! \file holidayrule.hpp
+    \brief declarative holiday rules and their compiled tables
+*/
+
+#ifndef quantlib_holiday_rule_hpp
+#define quantlib_holiday_rule_hpp
+
+#include <ql/time/date.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! declarative description of a yearly holiday
+    /*! A rule gives the date of a holiday in each year in which it
+        applies: a fixed day of a month, the n-th or last given weekday
+        of a month, or an offset from Easter Monday. An observance can
+        then move a holiday falling on a weekend to a nearby weekday.
+        One-off closings are fixed-date rules applying to a single year.
+
+        \ingroup datetime
+    */
+    class HolidayRule {
+      public:
+        //! how a holiday falling on a weekend is observed
+        enum Observance {
+            Actual,             //!< not moved
+            SundayToMonday,     //!< moved to Monday if on Sunday
+            NearestWeekday,     //!< moved to Friday if on Saturday and
+                                //!< to Monday if on Sunday
+            WeekendToMonday,    //!< moved to the following Monday
+            WeekendToTwoDaysLater //!< moved two days later, as for UK
+                                  //!< Christmas and Boxing Day
+        };
+        //! \name factories
+        //@{
+        static HolidayRule fixed(Month m, Day d,
+                                 Observance observance = Actual);
+        static HolidayRule nthWeekday(Size n, Weekday w, Month m);
+        static HolidayRule lastWeekday(Weekday w, Month m);
+        //! given number of days after (or before) Easter Monday
+        static HolidayRule easter(Integer offset);
+        //@}
+        //! \name year ranges
+        //@{
+        //! the same rule, only applying from the given year
+        HolidayRule since(Year y) const;
+        //! the same rule, only applying up to the given year
+        HolidayRule until(Year y) const;
+        //! the same rule, only applying in the given year
+        HolidayRule only(Year y) const;
+        //@}
+        //! serial number of the holiday in the given year
+        /*! Returns zero if the rule does not apply in the given year.
+            The year can lie just outside [Date::minDate(),
+            Date::maxDate()], as observed holidays can move across the
+            end of a year; Easter rules only apply within the range.
+            Easter Monday is given by the calendar, as either its
+            western or orthodox date.
+        */
+        Date::serial_type serialNumber(Year y,
+                                       Day (*easterMonday)(Year)) const;
+      private:
+        enum Kind { Fixed, NthWeekday, LastWeekday, Easter };
+        HolidayRule(Kind kind, Month m, Integer n, Weekday w,
+                    Observance observance);
+        Kind kind_;
+        Month month_;
+        // day of the month, n-th weekday, or offset from Easter Monday
+        Integer n_;
+        Weekday weekday_;
+        Observance observance_;
+        Year firstYear_, lastYear_;
+    };
+
+    //! holidays compiled from a table of rules or dates
+    /*! The rules are enumerated once for each year of the date range,
+        and the resulting holidays stored as one flag per date; checking
+        a date is then a single lookup. Holidays with no recurring rule
+        (e.g., those following the lunar calendar) can be given as a
+        list of dates instead. The table only knows about holidays, and
+        weekends are left to the calendar.
+
+        \ingroup datetime
+    */
+    class HolidayTable {
+      public:
+        HolidayTable(const HolidayRule* begin,
+                     const HolidayRule* end,
+                     Day (*easterMonday)(Year));
+        //! holidays given as a list of dates, in any order
+        HolidayTable(const Date* begin, const Date* end);
+        bool isHoliday(const Date& d) const;
+      private:
+        std::vector<bool> holidays_;
+    };
+
+
+    // inline definitions
+
+    inline bool HolidayTable::isHoliday(const Date& d) const {
+        static const Date::serial_type first =
+            Date::minDate().serialNumber();
+        return holidays_[d.serialNumber() - first];
+    }
+
+}
+
+
+#endif
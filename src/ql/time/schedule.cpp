@@ -22,6 +22,7 @@
 #include <ql/time/schedule.hpp>
 #include <ql/time/imm.hpp>
 #include <ql/settings.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -219,17 +220,20 @@ namespace QuantLib {
 
           case DateGeneration::Backward:
 
+            // dates are generated from the termination date backwards,
+            // so they are appended and put in order at the end;
+            // inserting each of them at the front would be quadratic
             dates_.push_back(terminationDate);
 
             seed = terminationDate;
             if (nextToLastDate_ != Date()) {
-                dates_.insert(dates_.begin(), nextToLastDate_);
+                dates_.push_back(nextToLastDate_);
                 Date temp = nullCalendar.advance(seed,
                     -periods*(*tenor_), convention, *endOfMonth_);
                 if (temp!=nextToLastDate_)
-                    isRegular_.insert(isRegular_.begin(), false);
+                    isRegular_.push_back(false);
                 else
-                    isRegular_.insert(isRegular_.begin(), true);
+                    isRegular_.push_back(true);
                 seed = nextToLastDate_;
             }
 
@@ -242,29 +246,32 @@ namespace QuantLib {
                     -periods*(*tenor_), convention, *endOfMonth_);
                 if (temp < exitDate) {
                     if (firstDate_ != Date() &&
-                        (calendar_.adjust(dates_.front(),convention)!=
+                        (calendar_.adjust(dates_.back(),convention)!=
                          calendar_.adjust(firstDate_,convention))) {
-                        dates_.insert(dates_.begin(), firstDate_);
-                        isRegular_.insert(isRegular_.begin(), false);
+                        dates_.push_back(firstDate_);
+                        isRegular_.push_back(false);
                     }
                     break;
                 } else {
                     // skip dates that would result in duplicates
                     // after adjustment
-                    if (calendar_.adjust(dates_.front(),convention)!=
+                    if (calendar_.adjust(dates_.back(),convention)!=
                         calendar_.adjust(temp,convention)) {
-                        dates_.insert(dates_.begin(), temp);
-                        isRegular_.insert(isRegular_.begin(), true);
+                        dates_.push_back(temp);
+                        isRegular_.push_back(true);
                     }
                     ++periods;
                 }
             }
 
-            if (calendar_.adjust(dates_.front(),convention)!=
+            if (calendar_.adjust(dates_.back(),convention)!=
                 calendar_.adjust(effectiveDate,convention)) {
-                dates_.insert(dates_.begin(), effectiveDate);
-                isRegular_.insert(isRegular_.begin(), false);
+                dates_.push_back(effectiveDate);
+                isRegular_.push_back(false);
             }
+
+            std::reverse(dates_.begin(), dates_.end());
+            std::reverse(isRegular_.begin(), isRegular_.end());
             break;
 
           case DateGeneration::Twentieth:
@@ -1,31 +1,130 @@
 #include "almanac.h"
 #include "utils.h"
+#include "parallel.h"
+#include "altrep.h"
 #include "ql/time/dategenerationrule.hpp"
 #include "ql/time/period.hpp"
 #include "ql/time/schedule.hpp"
 
-// [[Rcpp::export(rng=false)]]
-Rcpp::DateVector calendar_seq(const Rcpp::DateVector& start,
-                              const Rcpp::DateVector& stop,
-                              const int& by,
-                              const std::string& unit,
-                              const std::string& start_convention,
-                              const std::string& stop_convention,
-                              const bool& end_of_month,
-                              const Rcpp::List& calendar) {
-  const Rcpp::Date start_elt = start[0];
-  const Rcpp::Date stop_elt = stop[0];
+// Daily sequences are the business days between the adjusted end points,
+// which are read straight off the compiled calendar. This matches the
+// schedule when both end points use the same `following` or `preceding`
+// convention, since then every generated date is adjusted the same way
+// and the duplicates dropped. Other conventions, and `by > 1` where the
+// generated dates are not consecutive days, go through the schedule.
+// A result with less than two dates is a degenerate schedule, which is
+// also left to the schedule to report.
+static bool business_day_bounds(QuantLib::Date& from,
+                                QuantLib::Date& to,
+                                const QuantLib::Date& start,
+                                const QuantLib::Date& stop,
+                                QuantLib::BusinessDayConvention start_convention,
+                                QuantLib::BusinessDayConvention stop_convention,
+                                const QuantLib::Calendar& calendar) {
+  if (start_convention != stop_convention) {
+    return false;
+  }
 
-  if (Rcpp::DateVector::is_na(start_elt)) {
-    Rf_errorcall(R_NilValue, "`start` cannot be `NA`.");
+  if (start_convention == QuantLib::Following) {
+    from = start;
+    to = calendar.adjust(stop, QuantLib::Following);
+    return true;
   }
 
-  if (Rcpp::DateVector::is_na(stop_elt)) {
-    Rf_errorcall(R_NilValue, "`stop` cannot be `NA`.");
+  if (start_convention == QuantLib::Preceding) {
+    from = calendar.adjust(start, QuantLib::Preceding);
+    to = stop;
+    return true;
+  }
+
+  return false;
+}
+
+static bool seq_business_days(std::vector<QuantLib::Date>& dates,
+                              const QuantLib::Date& start,
+                              const QuantLib::Date& stop,
+                              QuantLib::BusinessDayConvention start_convention,
+                              QuantLib::BusinessDayConvention stop_convention,
+                              const QuantLib::Calendar& calendar) {
+  QuantLib::Date from;
+  QuantLib::Date to;
+
+  bool ok = business_day_bounds(
+    from,
+    to,
+    start,
+    stop,
+    start_convention,
+    stop_convention,
+    calendar
+  );
+
+  if (!ok) {
+    return false;
   }
 
+  dates = QuantLib::Calendar::businessDayList(calendar, from, to);
+
+  return dates.size() > 1;
+}
+
+#ifdef ALMANAC_HAS_ALTREP
+// The same business days as a lazy sequence over the compiled index, or
+// `R_NilValue` if the fast path doesn't apply or the index doesn't cover
+// the dates
+static SEXP seq_business_days_lazy(const QuantLib::Date& start,
+                                   const QuantLib::Date& stop,
+                                   QuantLib::BusinessDayConvention start_convention,
+                                   QuantLib::BusinessDayConvention stop_convention,
+                                   bool reverse,
+                                   const QuantLib::Calendar& calendar) {
+  QuantLib::Date from;
+  QuantLib::Date to;
+
+  bool ok = business_day_bounds(
+    from,
+    to,
+    start,
+    stop,
+    start_convention,
+    stop_convention,
+    calendar
+  );
+
+  if (!ok) {
+    return R_NilValue;
+  }
+
+  const QuantLib::ext::shared_ptr<const QuantLib::BusinessDayIndex>& index =
+    calendar.index();
+
+  if (!index || !index->covers(from) || !index->covers(to)) {
+    return R_NilValue;
+  }
+
+  QuantLib::Size first = index->rank(from);
+  QuantLib::Size last = index->rank(to) + (index->isBusinessDay(to) ? 1 : 0);
+
+  if (last - first < 2) {
+    return R_NilValue;
+  }
+
+  return new_business_day_seq(index, first, last - first, reverse);
+}
+#endif
+
+// The dates of the sequence from `start` to `stop`, always in increasing
+// order. When `start` is after `stop` the schedule is generated backwards
+// from `start`, and it is up to the caller to write it out from the back.
+static std::vector<QuantLib::Date> seq_dates(const QuantLib::Date& start,
+                                             const QuantLib::Date& stop,
+                                             int by,
+                                             QuantLib::TimeUnit unit,
+                                             QuantLib::BusinessDayConvention start_convention,
+                                             QuantLib::BusinessDayConvention stop_convention,
+                                             bool end_of_month,
+                                             const QuantLib::Calendar& calendar) {
   QuantLib::DateGeneration::Rule rule;
-  bool start_before_stop = start_elt <= stop_elt;
 
   QuantLib::Date ql_start;
   QuantLib::Date ql_stop;
@@ -33,52 +132,197 @@ Rcpp::DateVector calendar_seq(const Rcpp::DateVector& start,
   QuantLib::BusinessDayConvention ql_start_convention;
   QuantLib::BusinessDayConvention ql_stop_convention;
 
-  bool reverse;
-
-  if (start_before_stop) {
-    ql_start = as_quantlib_date(start_elt);
-    ql_stop = as_quantlib_date(stop_elt);
-    ql_start_convention = as_business_day_convention(start_convention);
-    ql_stop_convention = as_business_day_convention(stop_convention);
+  if (start <= stop) {
+    ql_start = start;
+    ql_stop = stop;
+    ql_start_convention = start_convention;
+    ql_stop_convention = stop_convention;
     rule = QuantLib::DateGeneration::Forward;
-    reverse = false;
   } else {
-    ql_start = as_quantlib_date(stop_elt);
-    ql_stop = as_quantlib_date(start_elt);
-    ql_start_convention = as_business_day_convention(stop_convention);
-    ql_stop_convention = as_business_day_convention(start_convention);
+    ql_start = stop;
+    ql_stop = start;
+    ql_start_convention = stop_convention;
+    ql_stop_convention = start_convention;
     rule = QuantLib::DateGeneration::Backward;
-    reverse = true;
   }
 
-  QuantLib::Calendar ql_calendar = new_calendar(calendar);
+  std::vector<QuantLib::Date> dates;
+
+  if (unit == QuantLib::Days && by == 1) {
+    bool done = seq_business_days(
+      dates,
+      ql_start,
+      ql_stop,
+      ql_start_convention,
+      ql_stop_convention,
+      calendar
+    );
 
-  QuantLib::TimeUnit ql_timeunit = as_time_unit(unit);
-  QuantLib::Period ql_period(by, ql_timeunit);
+    if (done) {
+      return dates;
+    }
+  }
+
+  QuantLib::Period ql_period(by, unit);
 
   QuantLib::Schedule schedule = QuantLib::MakeSchedule()
     .from(ql_start)
     .to(ql_stop)
     .withTenor(ql_period)
-    .withCalendar(ql_calendar)
+    .withCalendar(calendar)
     .withConvention(ql_start_convention)
     .withTerminationDateConvention(ql_stop_convention)
     .withRule(rule)
     .endOfMonth(end_of_month);
 
-  std::vector<QuantLib::Date> new_dates = schedule.dates();
+  return schedule.dates();
+}
+
+static void copy_seq_dates(const std::vector<QuantLib::Date>& dates,
+                           bool reverse,
+                           double* p_out) {
+  int size = dates.size();
+
+  if (reverse) {
+    for (int i = 0; i < size; ++i) {
+      p_out[size - 1 - i] = as_r_double(dates[i]);
+    }
+  } else {
+    for (int i = 0; i < size; ++i) {
+      p_out[i] = as_r_double(dates[i]);
+    }
+  }
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP calendar_seq(const Rcpp::DateVector& start,
+                  const Rcpp::DateVector& stop,
+                  const int& by,
+                  const std::string& unit,
+                  const std::string& start_convention,
+                  const std::string& stop_convention,
+                  const bool& end_of_month,
+                  const Rcpp::List& calendar) {
+  const Rcpp::Date start_elt = start[0];
+  const Rcpp::Date stop_elt = stop[0];
+
+  if (Rcpp::DateVector::is_na(start_elt)) {
+    Rf_errorcall(R_NilValue, "`start` cannot be `NA`.");
+  }
+
+  if (Rcpp::DateVector::is_na(stop_elt)) {
+    Rf_errorcall(R_NilValue, "`stop` cannot be `NA`.");
+  }
+
+  QuantLib::Date ql_start = as_quantlib_date(start_elt);
+  QuantLib::Date ql_stop = as_quantlib_date(stop_elt);
+
+  QuantLib::Calendar ql_calendar = new_calendar(calendar);
+
+  QuantLib::TimeUnit ql_unit = as_time_unit(unit);
+  QuantLib::BusinessDayConvention ql_start_convention = as_business_day_convention(start_convention);
+  QuantLib::BusinessDayConvention ql_stop_convention = as_business_day_convention(stop_convention);
+
+  bool reverse = ql_start > ql_stop;
+
+#ifdef ALMANAC_HAS_ALTREP
+  // Returned as a `SEXP`, since wrapping a lazy sequence in an Rcpp vector
+  // would materialize it
+  if (ql_unit == QuantLib::Days && by == 1) {
+    SEXP out = seq_business_days_lazy(
+      reverse ? ql_stop : ql_start,
+      reverse ? ql_start : ql_stop,
+      reverse ? ql_stop_convention : ql_start_convention,
+      reverse ? ql_start_convention : ql_stop_convention,
+      reverse,
+      ql_calendar
+    );
+
+    if (out != R_NilValue) {
+      return out;
+    }
+  }
+#endif
+
+  std::vector<QuantLib::Date> new_dates = seq_dates(
+    ql_start,
+    ql_stop,
+    by,
+    ql_unit,
+    ql_start_convention,
+    ql_stop_convention,
+    end_of_month,
+    ql_calendar
+  );
 
   int size = new_dates.size();
   Rcpp::DateVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    out[i] = as_r_date(new_dates[i]);
+  copy_seq_dates(new_dates, reverse, out.begin());
+
+  return out;
+}
+
+// All of the arguments other than `calendar` have already been recycled to
+// a common size and validated by `cal_seq_many()`, so nothing below raises an
+// R error past the C++ objects that are alive. The schedules are generated
+// into plain vectors, possibly on several threads, and only copied into R
+// vectors once they are all done.
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List calendar_seq_many(SEXP start,
+                             SEXP stop,
+                             const std::vector<int>& by,
+                             const std::vector<std::string>& unit,
+                             const std::vector<std::string>& start_convention,
+                             const std::vector<std::string>& stop_convention,
+                             const std::vector<bool>& end_of_month,
+                             const Rcpp::List& calendar) {
+  QuantLib::Calendar ql_calendar = new_calendar(calendar);
+
+  r_dates starts(start);
+  r_dates stops(stop);
+  R_xlen_t size = starts.size();
+
+  // Parse the strings once, on the main thread
+  std::vector<QuantLib::TimeUnit> units(size);
+  std::vector<QuantLib::BusinessDayConvention> start_conventions(size);
+  std::vector<QuantLib::BusinessDayConvention> stop_conventions(size);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    units[i] = as_time_unit(unit[i]);
+    start_conventions[i] = as_business_day_convention(start_convention[i]);
+    stop_conventions[i] = as_business_day_convention(stop_convention[i]);
   }
 
-  if (reverse) {
-    std::reverse(out.begin(), out.end());
+  std::vector< std::vector<QuantLib::Date> > schedules(size);
+
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      schedules[i] = seq_dates(
+        starts[i],
+        stops[i],
+        by[i],
+        units[i],
+        start_conventions[i],
+        stop_conventions[i],
+        end_of_month[i],
+        ql_calendar
+      );
+    }
+  });
+
+  Rcpp::List out(size);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    int elt_size = schedules[i].size();
+    Rcpp::DateVector elt(elt_size);
+    copy_seq_dates(schedules[i], starts[i] > stops[i], elt.begin());
+    out[i] = elt;
+
+    // Release each schedule as soon as it has been copied
+    std::vector<QuantLib::Date>().swap(schedules[i]);
   }
 
-  reset_calendar(ql_calendar);
   return out;
 }
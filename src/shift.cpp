@@ -1,5 +1,7 @@
 #include "almanac.h"
 #include "utils.h"
+#include "parallel.h"
+#include "unique.h"
 
 // NOTE:
 // We are NOT implementing `end_of_month` here like they do in `advance()`.
@@ -24,7 +26,7 @@ static QuantLib::Date multi_advance(const QuantLib::Date& date,
                                     int month,
                                     int day,
                                     const QuantLib::BusinessDayConvention convention,
-                                    const QuantLib::Calendar calendar) {
+                                    const QuantLib::Calendar& calendar) {
   QuantLib::Date new_date = date;
 
   // Year and Month shifts first
@@ -36,36 +38,21 @@ static QuantLib::Date multi_advance(const QuantLib::Date& date,
     return calendar.adjust(new_date, convention);
   }
 
-  // If there is a day shift, don't call adjust(), but instead use isHoliday()
-  if (day > 0) {
-    while (day > 0) {
-      new_date++;
-      while (calendar.isHoliday(new_date))
-        new_date++;
-      day--;
-    }
-
-    return new_date;
-  }
-
-  while (day < 0) {
-    new_date--;
-    while(calendar.isHoliday(new_date))
-      new_date--;
-    day++;
-  }
-
-  return new_date;
+  // If there is a day shift, don't call adjust(), but instead move `day`
+  // business days. On a compiled calendar this is a rank and a select
+  // lookup, so the cost doesn't depend on the size of the shift.
+  return calendar.advance(new_date, day, QuantLib::TimeUnit::Days);
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::DateVector calendar_shift(const Rcpp::DateVector& x,
+Rcpp::DateVector calendar_shift(SEXP x,
                                 const Rcpp::List& period,
                                 const std::string& convention,
                                 const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
   int year = period[0];
   int month = period[1];
@@ -73,65 +60,76 @@ Rcpp::DateVector calendar_shift(const Rcpp::DateVector& x,
 
   QuantLib::BusinessDayConvention ql_convention = as_business_day_convention(convention);
 
-  QuantLib::Date ql_date;
-  QuantLib::Date new_ql_date;
-
-  Rcpp::Date date;
   Rcpp::DateVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  double* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_REAL;
-      continue;
-    }
+  if (use_unique_dates(size)) {
+    map_unique_dates(dates, p_out, NA_REAL, [&](const QuantLib::Date& ql_date) {
+      return as_r_double(
+        multi_advance(ql_date, year, month, day, ql_convention, ql_calendar)
+      );
+    });
 
-    ql_date = as_quantlib_date(date);
-
-    new_ql_date = multi_advance(
-      ql_date,
-      year,
-      month,
-      day,
-      ql_convention,
-      ql_calendar
-    );
-
-    out[i] = as_r_date(new_ql_date);
+    return out;
   }
 
-  reset_calendar(ql_calendar);
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      if (i > begin && dates.repeats(i)) {
+        p_out[i] = p_out[i - 1];
+        continue;
+      }
+
+      QuantLib::Date ql_date = dates[i];
+
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_REAL;
+        continue;
+      }
+
+      QuantLib::Date new_ql_date = multi_advance(
+        ql_date,
+        year,
+        month,
+        day,
+        ql_convention,
+        ql_calendar
+      );
+
+      p_out[i] = as_r_double(new_ql_date);
+    }
+  });
+
   return out;
 }
 
 // [[Rcpp::export(rng=false)]]
-Rcpp::DateVector calendar_shift_end_of_month(const Rcpp::DateVector x,
+Rcpp::DateVector calendar_shift_end_of_month(SEXP x,
                                              const Rcpp::List& calendar) {
   QuantLib::Calendar ql_calendar = new_calendar(calendar);
 
-  int size = x.size();
+  r_dates dates(x);
+  R_xlen_t size = dates.size();
 
-  Rcpp::Date date;
-  QuantLib::Date ql_date;
-  QuantLib::Date new_ql_date;
   Rcpp::DateVector out(size);
 
-  for (int i = 0; i < size; ++i) {
-    date = x[i];
+  double* p_out = out.begin();
 
-    if (Rcpp::DateVector::is_na(date)) {
-      out[i] = NA_REAL;
-      continue;
-    }
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date ql_date = dates[i];
 
-    ql_date = as_quantlib_date(date);
+      if (ql_date == QuantLib::Date()) {
+        p_out[i] = NA_REAL;
+        continue;
+      }
 
-    new_ql_date = ql_calendar.endOfMonth(ql_date);
+      QuantLib::Date new_ql_date = ql_calendar.endOfMonth(ql_date);
 
-    out[i] = as_r_date(new_ql_date);
-  }
+      p_out[i] = as_r_double(new_ql_date);
+    }
+  });
 
-  reset_calendar(ql_calendar);
   return out;
 }
@@ -0,0 +1,81 @@
+#ifndef ALMANAC_UNIQUE_H
+#define ALMANAC_UNIQUE_H
+
+#include "almanac.h"
+#include "parallel.h"
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Computing results once per distinct date
+//
+// Dates are bounded by the range QuantLib supports (1901-2199), so a vector
+// longer than that range must repeat dates, and panel data often has far
+// fewer distinct dates than rows. `map_unique_dates()` marks the distinct
+// dates in a flat table indexed by serial number, calls `fn(date)` once for
+// each of them, and then scatters the results back to every element.
+// Missing dates get `na`.
+//
+// `fn` is called from worker threads, see `parallel_for()`.
+
+inline QuantLib::Date::serial_type unique_dates_first() {
+  return QuantLib::Date::minDate().serialNumber();
+}
+
+inline R_xlen_t unique_dates_size() {
+  return QuantLib::Date::maxDate().serialNumber() - unique_dates_first() + 1;
+}
+
+// Only worth it once the vector is at least as long as the table, at which
+// point the extra passes are cheaper than the repeated calendar lookups
+inline bool use_unique_dates(R_xlen_t size) {
+  return size >= unique_dates_size();
+}
+
+template <class T, class F>
+void map_unique_dates(const r_dates& dates, T* p_out, T na, const F& fn) {
+  const R_xlen_t size = dates.size();
+  const QuantLib::Date::serial_type first = unique_dates_first();
+
+  std::vector<unsigned char> seen(unique_dates_size(), 0);
+
+  for (R_xlen_t i = 0; i < size; ++i) {
+    QuantLib::Date date = dates[i];
+
+    if (date == QuantLib::Date()) {
+      continue;
+    }
+
+    seen[date.serialNumber() - first] = 1;
+  }
+
+  std::vector<QuantLib::Date::serial_type> uniques;
+
+  for (std::size_t j = 0; j < seen.size(); ++j) {
+    if (seen[j]) {
+      uniques.push_back(first + j);
+    }
+  }
+
+  std::vector<T> table(seen.size());
+
+  parallel_for(uniques.size(), [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t j = begin; j < end; ++j) {
+      table[uniques[j] - first] = fn(QuantLib::Date(uniques[j]));
+    }
+  });
+
+  parallel_for(size, [&](R_xlen_t begin, R_xlen_t end) {
+    for (R_xlen_t i = begin; i < end; ++i) {
+      QuantLib::Date date = dates[i];
+
+      if (date == QuantLib::Date()) {
+        p_out[i] = na;
+        continue;
+      }
+
+      p_out[i] = table[date.serialNumber() - first];
+    }
+  });
+}
+
+#endif
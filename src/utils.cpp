@@ -83,3 +83,15 @@ QuantLib::Weekday as_weekday(const int& weekday) {
 
   Rf_errorcall(R_NilValue, "Unknown `weekday`, %i", weekday);
 }
+
+QuantLib::JointCalendarRule as_joint_calendar_rule(const std::string& rule) {
+  if (rule == "holidays") {
+    return QuantLib::JoinHolidays;
+  }
+
+  if (rule == "business_days") {
+    return QuantLib::JoinBusinessDays;
+  }
+
+  Rf_errorcall(R_NilValue, "Unknown `rule`, %s", rule.c_str());
+}
@@ -4,9 +4,11 @@
 #include "almanac.h"
 #include "ql/time/businessdayconvention.hpp"
 #include "ql/time/timeunit.hpp"
+#include "ql/time/calendars/jointcalendar.hpp"
 
 QuantLib::BusinessDayConvention as_business_day_convention(const std::string& convention);
 QuantLib::TimeUnit as_time_unit(const std::string &unit);
 QuantLib::Weekday as_weekday(const int& weekday);
+QuantLib::JointCalendarRule as_joint_calendar_rule(const std::string& rule);
 
 #endif